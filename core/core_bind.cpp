@@ -29,6 +29,7 @@
 /**************************************************************************/
 
 #include "core_bind.h"
+#include "core_bind.compat.inc"
 
 #include "core/config/project_settings.h"
 #include "core/crypto/crypto_core.h"
@@ -48,8 +49,8 @@ namespace core_bind {
 
 ResourceLoader *ResourceLoader::singleton = nullptr;
 
-Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, CacheMode p_cache_mode) {
-	return ::ResourceLoader::load_threaded_request(p_path, p_type_hint, p_use_sub_threads, ResourceFormatLoader::CacheMode(p_cache_mode));
+Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, CacheMode p_cache_mode, int p_priority) {
+	return ::ResourceLoader::load_threaded_request(p_path, p_type_hint, p_use_sub_threads, ResourceFormatLoader::CacheMode(p_cache_mode), p_priority);
 }
 
 ResourceLoader::ThreadLoadStatus ResourceLoader::load_threaded_get_status(const String &p_path, Array r_progress) {
@@ -66,6 +67,20 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path) {
 	return res;
 }
 
+Error ResourceLoader::load_threaded_set_priority(const String &p_path, int p_priority) {
+	return ::ResourceLoader::load_threaded_set_priority(p_path, p_priority);
+}
+
+Error ResourceLoader::load_threaded_cancel(const String &p_path) {
+	return ::ResourceLoader::load_threaded_cancel(p_path);
+}
+
+void ResourceLoader::_load_progress_notify(const String &p_path, ::ResourceLoader::ThreadLoadStatus p_status, float p_progress) {
+	if (singleton) {
+		singleton->emit_signal(SNAME("load_threaded_progress"), p_path, (ThreadLoadStatus)p_status, p_progress);
+	}
+}
+
 Ref<Resource> ResourceLoader::load(const String &p_path, const String &p_type_hint, CacheMode p_cache_mode) {
 	Error err = OK;
 	Ref<Resource> ret = ::ResourceLoader::load(p_path, p_type_hint, ResourceFormatLoader::CacheMode(p_cache_mode), &err);
@@ -123,9 +138,11 @@ ResourceUID::ID ResourceLoader::get_resource_uid(const String &p_path) {
 }
 
 void ResourceLoader::_bind_methods() {
-	ClassDB::bind_method(D_METHOD("load_threaded_request", "path", "type_hint", "use_sub_threads", "cache_mode"), &ResourceLoader::load_threaded_request, DEFVAL(""), DEFVAL(false), DEFVAL(CACHE_MODE_REUSE));
+	ClassDB::bind_method(D_METHOD("load_threaded_request", "path", "type_hint", "use_sub_threads", "cache_mode", "priority"), &ResourceLoader::load_threaded_request, DEFVAL(""), DEFVAL(false), DEFVAL(CACHE_MODE_REUSE), DEFVAL(0));
 	ClassDB::bind_method(D_METHOD("load_threaded_get_status", "path", "progress"), &ResourceLoader::load_threaded_get_status, DEFVAL(Array()));
 	ClassDB::bind_method(D_METHOD("load_threaded_get", "path"), &ResourceLoader::load_threaded_get);
+	ClassDB::bind_method(D_METHOD("load_threaded_set_priority", "path", "priority"), &ResourceLoader::load_threaded_set_priority);
+	ClassDB::bind_method(D_METHOD("load_threaded_cancel", "path"), &ResourceLoader::load_threaded_cancel);
 
 	ClassDB::bind_method(D_METHOD("load", "path", "type_hint", "cache_mode"), &ResourceLoader::load, DEFVAL(""), DEFVAL(CACHE_MODE_REUSE));
 	ClassDB::bind_method(D_METHOD("get_recognized_extensions_for_type", "type"), &ResourceLoader::get_recognized_extensions_for_type);
@@ -147,6 +164,18 @@ void ResourceLoader::_bind_methods() {
 	BIND_ENUM_CONSTANT(CACHE_MODE_REPLACE);
 	BIND_ENUM_CONSTANT(CACHE_MODE_IGNORE_DEEP);
 	BIND_ENUM_CONSTANT(CACHE_MODE_REPLACE_DEEP);
+
+	ADD_SIGNAL(MethodInfo("load_threaded_progress", PropertyInfo(Variant::STRING, "path"), PropertyInfo(Variant::INT, "status", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_CLASS_IS_ENUM, "ResourceLoader.ThreadLoadStatus"), PropertyInfo(Variant::FLOAT, "progress")));
+}
+
+ResourceLoader::ResourceLoader() {
+	singleton = this;
+	::ResourceLoader::set_load_progress_notify_func(&ResourceLoader::_load_progress_notify);
+}
+
+ResourceLoader::~ResourceLoader() {
+	::ResourceLoader::set_load_progress_notify_func(nullptr);
+	singleton = nullptr;
 }
 
 ////// ResourceSaver //////
@@ -155,6 +184,20 @@ Error ResourceSaver::save(const Ref<Resource> &p_resource, const String &p_path,
 	return ::ResourceSaver::save(p_resource, p_path, p_flags);
 }
 
+Error ResourceSaver::save_threaded(const Ref<Resource> &p_resource, const String &p_path, BitField<SaverFlags> p_flags) {
+	return ::ResourceSaver::save_threaded(p_resource, p_path, p_flags);
+}
+
+bool ResourceSaver::is_threaded_save_pending(const String &p_path) {
+	return ::ResourceSaver::is_threaded_save_pending(p_path);
+}
+
+void ResourceSaver::_threaded_save_notify(const String &p_path, Error p_error) {
+	if (singleton) {
+		singleton->emit_signal(SNAME("threaded_save_completed"), p_path, p_error);
+	}
+}
+
 Vector<String> ResourceSaver::get_recognized_extensions(const Ref<Resource> &p_resource) {
 	List<String> exts;
 	::ResourceSaver::get_recognized_extensions(p_resource, &exts);
@@ -177,6 +220,8 @@ ResourceSaver *ResourceSaver::singleton = nullptr;
 
 void ResourceSaver::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("save", "resource", "path", "flags"), &ResourceSaver::save, DEFVAL(""), DEFVAL((uint32_t)FLAG_NONE));
+	ClassDB::bind_method(D_METHOD("save_threaded", "resource", "path", "flags"), &ResourceSaver::save_threaded, DEFVAL(""), DEFVAL((uint32_t)FLAG_NONE));
+	ClassDB::bind_method(D_METHOD("is_threaded_save_pending", "path"), &ResourceSaver::is_threaded_save_pending);
 	ClassDB::bind_method(D_METHOD("get_recognized_extensions", "type"), &ResourceSaver::get_recognized_extensions);
 	ClassDB::bind_method(D_METHOD("add_resource_format_saver", "format_saver", "at_front"), &ResourceSaver::add_resource_format_saver, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("remove_resource_format_saver", "format_saver"), &ResourceSaver::remove_resource_format_saver);
@@ -189,6 +234,18 @@ void ResourceSaver::_bind_methods() {
 	BIND_BITFIELD_FLAG(FLAG_SAVE_BIG_ENDIAN);
 	BIND_BITFIELD_FLAG(FLAG_COMPRESS);
 	BIND_BITFIELD_FLAG(FLAG_REPLACE_SUBRESOURCE_PATHS);
+
+	ADD_SIGNAL(MethodInfo("threaded_save_completed", PropertyInfo(Variant::STRING, "path"), PropertyInfo(Variant::INT, "error", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_CLASS_IS_ENUM, "Error")));
+}
+
+ResourceSaver::ResourceSaver() {
+	singleton = this;
+	::ResourceSaver::set_threaded_save_notify_func(&ResourceSaver::_threaded_save_notify);
+}
+
+ResourceSaver::~ResourceSaver() {
+	::ResourceSaver::set_threaded_save_notify_func(nullptr);
+	singleton = nullptr;
 }
 
 ////// OS //////
@@ -54,6 +54,8 @@ protected:
 	static void _bind_methods();
 	static ResourceLoader *singleton;
 
+	static void _load_progress_notify(const String &p_path, ::ResourceLoader::ThreadLoadStatus p_status, float p_progress);
+
 public:
 	enum ThreadLoadStatus {
 		THREAD_LOAD_INVALID_RESOURCE,
@@ -70,11 +72,20 @@ public:
 		CACHE_MODE_REPLACE_DEEP,
 	};
 
+protected:
+#ifndef DISABLE_DEPRECATED
+	Error _load_threaded_request_bind_compat_load_priority(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, CacheMode p_cache_mode = CACHE_MODE_REUSE);
+	static void _bind_compatibility_methods();
+#endif // DISABLE_DEPRECATED
+
+public:
 	static ResourceLoader *get_singleton() { return singleton; }
 
-	Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, CacheMode p_cache_mode = CACHE_MODE_REUSE);
+	Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, CacheMode p_cache_mode = CACHE_MODE_REUSE, int p_priority = 0);
 	ThreadLoadStatus load_threaded_get_status(const String &p_path, Array r_progress = Array());
 	Ref<Resource> load_threaded_get(const String &p_path);
+	Error load_threaded_set_priority(const String &p_path, int p_priority);
+	Error load_threaded_cancel(const String &p_path);
 
 	Ref<Resource> load(const String &p_path, const String &p_type_hint = "", CacheMode p_cache_mode = CACHE_MODE_REUSE);
 	Vector<String> get_recognized_extensions_for_type(const String &p_type);
@@ -86,7 +97,8 @@ public:
 	bool exists(const String &p_path, const String &p_type_hint = "");
 	ResourceUID::ID get_resource_uid(const String &p_path);
 
-	ResourceLoader() { singleton = this; }
+	ResourceLoader();
+	~ResourceLoader();
 };
 
 class ResourceSaver : public Object {
@@ -96,6 +108,8 @@ protected:
 	static void _bind_methods();
 	static ResourceSaver *singleton;
 
+	static void _threaded_save_notify(const String &p_path, Error p_error);
+
 public:
 	enum SaverFlags {
 		FLAG_NONE = 0,
@@ -111,11 +125,14 @@ public:
 	static ResourceSaver *get_singleton() { return singleton; }
 
 	Error save(const Ref<Resource> &p_resource, const String &p_path, BitField<SaverFlags> p_flags);
+	Error save_threaded(const Ref<Resource> &p_resource, const String &p_path, BitField<SaverFlags> p_flags);
+	bool is_threaded_save_pending(const String &p_path);
 	Vector<String> get_recognized_extensions(const Ref<Resource> &p_resource);
 	void add_resource_format_saver(Ref<ResourceFormatSaver> p_format_saver, bool p_at_front);
 	void remove_resource_format_saver(Ref<ResourceFormatSaver> p_format_saver);
 
-	ResourceSaver() { singleton = this; }
+	ResourceSaver();
+	~ResourceSaver();
 };
 
 class OS : public Object {
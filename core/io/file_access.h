@@ -150,6 +150,12 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const; ///< get an array of bytes
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	/**
+	 * Returns a pointer to the next p_length bytes and advances the position, without copying them.
+	 * The memory stays valid until the file is closed. Returns nullptr (and keeps the position) if the
+	 * backend can't provide a view of that range, in which case get_buffer() must be used instead.
+	 */
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const { return nullptr; }
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
@@ -30,6 +30,8 @@
 
 #include "file_access_compressed.h"
 
+#include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
 
 void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
@@ -76,17 +78,113 @@ Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	comp_buffer.resize(max_bs);
 	buffer.resize(block_size);
 	read_ptr = buffer.ptrw();
-	f->get_buffer(comp_buffer.ptrw(), read_blocks[0].csize);
-	at_end = false;
+	at_end = read_total == 0;
 	read_eof = false;
 	read_block_count = bc;
-	read_block_size = read_blocks.size() == 1 ? read_total : block_size;
 
-	int ret = Compression::decompress(buffer.ptrw(), read_block_size, comp_buffer.ptr(), read_blocks[0].csize, cmode);
-	read_block = 0;
+	return _read_block(0) ? OK : ERR_FILE_CORRUPT;
+}
+
+uint32_t FileAccessCompressed::_get_block_size(uint32_t p_block) const {
+	return p_block == read_block_count - 1 ? read_total % block_size : block_size;
+}
+
+bool FileAccessCompressed::_read_block(uint32_t p_block) const {
+	const ReadBlock &rb = read_blocks[p_block];
+	if (f->get_position() != rb.offset) {
+		f->seek(rb.offset);
+	}
+	f->get_buffer(comp_buffer.ptrw(), rb.csize);
+
+	read_block = p_block;
+	read_block_size = _get_block_size(p_block);
 	read_pos = 0;
 
-	return ret == -1 ? ERR_FILE_CORRUPT : OK;
+	int ret = Compression::decompress(buffer.ptrw(), read_block_count == 1 ? read_total : block_size, comp_buffer.ptr(), rb.csize, cmode);
+	return ret != -1;
+}
+
+void FileAccessCompressed::_next_block() const {
+	if (read_block + 1 >= read_block_count || _get_block_size(read_block + 1) == 0) {
+		at_end = true;
+		return;
+	}
+	ERR_FAIL_COND_MSG(!_read_block(read_block + 1), "Compressed file is corrupt.");
+}
+
+void FileAccessCompressed::_decompress_block_task(void *p_userdata, uint32_t p_index) {
+	BlockTask *task = (BlockTask *)p_userdata;
+	const ReadBlock &rb = task->read_blocks[p_index];
+	int ret = Compression::decompress(task->dst + (uint64_t)p_index * task->block_size, task->block_size, task->src + (rb.offset - task->read_blocks[0].offset), rb.csize, task->mode);
+	if (ret == -1) {
+		task->failed.set();
+	}
+}
+
+bool FileAccessCompressed::_decompress_blocks(uint32_t p_first, uint32_t p_count, uint8_t *p_dst) const {
+	// Blocks are stored back to back, so all of them can be read at once.
+	const ReadBlock &first = read_blocks[p_first];
+	const ReadBlock &last = read_blocks[p_first + p_count - 1];
+	uint64_t csize = last.offset + last.csize - first.offset;
+	if ((uint64_t)multi_comp_buffer.size() < csize) {
+		multi_comp_buffer.resize(csize);
+	}
+	if (f->get_position() != first.offset) {
+		f->seek(first.offset);
+	}
+	if (f->get_buffer(multi_comp_buffer.ptrw(), csize) != csize) {
+		return false;
+	}
+
+	BlockTask task;
+	task.read_blocks = &first;
+	task.src = multi_comp_buffer.ptr();
+	task.dst = p_dst;
+	task.block_size = block_size;
+	task.mode = cmode;
+
+	if (p_count >= PARALLEL_MIN_BLOCKS && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&FileAccessCompressed::_decompress_block_task, &task, p_count, -1, true, SNAME("FileAccessCompressed"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	} else {
+		for (uint32_t i = 0; i < p_count; i++) {
+			_decompress_block_task(&task, i);
+		}
+	}
+
+	return !task.failed.is_set();
+}
+
+Vector<uint8_t> FileAccessCompressed::compress_buffer(const uint8_t *p_data, uint64_t p_size, const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
+	ERR_FAIL_COND_V(p_block_size == 0, Vector<uint8_t>());
+	ERR_FAIL_COND_V_MSG(p_size > UINT32_MAX, Vector<uint8_t>(), "Can't compress buffers larger than 4 GiB.");
+
+	CharString mgc = (String(p_magic.ascii().get_data()) + "    ").substr(0, 4).utf8();
+	uint32_t bc = (p_size / p_block_size) + 1;
+	uint64_t header_size = 16 + bc * 4;
+
+	Vector<uint8_t> ret;
+	ret.resize(header_size + (uint64_t)Compression::get_max_compressed_buffer_size(p_block_size, p_mode) * bc + 4);
+	uint8_t *w = ret.ptrw();
+
+	memcpy(w, mgc.get_data(), 4);
+	encode_uint32(p_mode, w + 4);
+	encode_uint32(p_block_size, w + 8);
+	encode_uint32(p_size, w + 12);
+
+	uint64_t ofs = header_size;
+	for (uint32_t i = 0; i < bc; i++) {
+		uint32_t bl = i == (bc - 1) ? p_size % p_block_size : p_block_size;
+		int s = Compression::compress(w + ofs, p_data + (uint64_t)i * p_block_size, bl, p_mode);
+		ERR_FAIL_COND_V(s < 0, Vector<uint8_t>());
+		encode_uint32(s, w + 16 + i * 4);
+		ofs += s;
+	}
+	memcpy(w + ofs, mgc.get_data(), 4); // Magic at the end too.
+	ofs += 4;
+
+	ret.resize(ofs);
+	return ret;
 }
 
 Error FileAccessCompressed::open_internal(const String &p_path, int p_mode_flags) {
@@ -125,6 +223,17 @@ Error FileAccessCompressed::open_internal(const String &p_path, int p_mode_flags
 	return OK;
 }
 
+void FileAccessCompressed::_compress_block_task(void *p_userdata, uint32_t p_index) {
+	CompressTask *task = (CompressTask *)p_userdata;
+	uint64_t ofs = (uint64_t)p_index * task->block_size;
+	uint32_t bl = MIN(task->size - ofs, (uint64_t)task->block_size);
+
+	Vector<uint8_t> &cblock = task->cblocks[p_index];
+	cblock.resize(Compression::get_max_compressed_buffer_size(bl, task->mode));
+	int s = Compression::compress(cblock.ptrw(), task->src + ofs, bl, task->mode);
+	cblock.resize(MAX(s, 0));
+}
+
 void FileAccessCompressed::_close() {
 	if (f.is_null()) {
 		return;
@@ -144,22 +253,33 @@ void FileAccessCompressed::_close() {
 			f->store_32(0); //compressed sizes, will update later
 		}
 
-		Vector<int> block_sizes;
-		for (uint32_t i = 0; i < bc; i++) {
-			uint32_t bl = i == (bc - 1) ? write_max % block_size : block_size;
-			uint8_t *bp = &write_ptr[i * block_size];
+		// Blocks are independent, so they can be compressed in parallel and stored in order afterwards.
+		LocalVector<Vector<uint8_t>> cblocks;
+		cblocks.resize(bc);
 
-			Vector<uint8_t> cblock;
-			cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
-			int s = Compression::compress(cblock.ptrw(), bp, bl, cmode);
+		CompressTask task;
+		task.src = write_ptr;
+		task.size = write_max;
+		task.block_size = block_size;
+		task.mode = cmode;
+		task.cblocks = cblocks.ptr();
 
-			f->store_buffer(cblock.ptr(), s);
-			block_sizes.push_back(s);
+		if (bc >= PARALLEL_MIN_BLOCKS && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+			WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&FileAccessCompressed::_compress_block_task, &task, bc, -1, true, SNAME("FileAccessCompressed"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		} else {
+			for (uint32_t i = 0; i < bc; i++) {
+				_compress_block_task(&task, i);
+			}
+		}
+
+		for (uint32_t i = 0; i < bc; i++) {
+			f->store_buffer(cblocks[i].ptr(), cblocks[i].size());
 		}
 
 		f->seek(16); //ok write block sizes
 		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(block_sizes[i]);
+			f->store_32(cblocks[i].size());
 		}
 		f->seek_end();
 		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //magic at the end too
@@ -211,12 +331,7 @@ void FileAccessCompressed::seek(uint64_t p_position) {
 			read_eof = false;
 			uint32_t block_idx = p_position / block_size;
 			if (block_idx != read_block) {
-				read_block = block_idx;
-				f->seek(read_blocks[read_block].offset);
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_MSG(ret == -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+				ERR_FAIL_COND_MSG(!_read_block(block_idx), "Compressed file is corrupt.");
 			}
 
 			read_pos = p_position % block_size;
@@ -237,6 +352,8 @@ uint64_t FileAccessCompressed::get_position() const {
 	ERR_FAIL_COND_V_MSG(f.is_null(), 0, "File must be opened before use.");
 	if (writing) {
 		return write_pos;
+	} else if (at_end) {
+		return read_total;
 	} else {
 		return (uint64_t)read_block * block_size + read_pos;
 	}
@@ -273,20 +390,7 @@ uint8_t FileAccessCompressed::get_8() const {
 
 	read_pos++;
 	if (read_pos >= read_block_size) {
-		read_block++;
-
-		if (read_block < read_block_count) {
-			//read another block of compressed data
-			f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-			int total = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-			ERR_FAIL_COND_V_MSG(total == -1, 0, "Compressed file is corrupt.");
-			read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
-			read_pos = 0;
-
-		} else {
-			read_block--;
-			at_end = true;
-		}
+		_next_block();
 	}
 
 	return ret;
@@ -302,32 +406,41 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 		return 0;
 	}
 
-	for (uint64_t i = 0; i < p_length; i++) {
-		p_dst[i] = read_ptr[read_pos];
-		read_pos++;
-		if (read_pos >= read_block_size) {
-			read_block++;
-
-			if (read_block < read_block_count) {
-				//read another block of compressed data
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_V_MSG(ret == -1, -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
-				read_pos = 0;
-
-			} else {
-				read_block--;
-				at_end = true;
-				if (i + 1 < p_length) {
-					read_eof = true;
-				}
-				return i + 1;
+	uint64_t dst_ofs = 0;
+	while (dst_ofs < p_length) {
+		uint64_t to_copy = MIN((uint64_t)(read_block_size - read_pos), p_length - dst_ofs);
+		memcpy(p_dst + dst_ofs, read_ptr + read_pos, to_copy);
+		dst_ofs += to_copy;
+		read_pos += to_copy;
+		if (read_pos < read_block_size) {
+			break;
+		}
+
+		// Blocks that the rest of the request covers completely are decompressed straight into it.
+		uint32_t first_block = read_block + 1;
+		uint32_t full_blocks = first_block < read_block_count - 1 ? read_block_count - 1 - first_block : 0; // The last block is never full.
+		uint32_t whole_blocks = MIN((p_length - dst_ofs) / block_size, (uint64_t)full_blocks);
+		if (whole_blocks > 0) {
+			ERR_FAIL_COND_V_MSG(!_decompress_blocks(first_block, whole_blocks, p_dst + dst_ofs), -1, "Compressed file is corrupt.");
+			dst_ofs += (uint64_t)whole_blocks * block_size;
+
+			// Keep the last one as the current block, so seeking back into it works as usual.
+			memcpy(read_ptr, p_dst + dst_ofs - block_size, block_size);
+			read_block = first_block + whole_blocks - 1;
+			read_block_size = block_size;
+			read_pos = block_size;
+		}
+
+		_next_block();
+		if (at_end) {
+			if (dst_ofs < p_length) {
+				read_eof = true;
 			}
+			break;
 		}
 	}
 
-	return p_length;
+	return dst_ofs;
 }
 
 Error FileAccessCompressed::get_error() const {
@@ -349,6 +462,16 @@ void FileAccessCompressed::store_8(uint8_t p_dest) {
 	write_ptr[write_pos++] = p_dest;
 }
 
+void FileAccessCompressed::store_buffer(const uint8_t *p_src, uint64_t p_length) {
+	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(!writing, "File has not been opened in write mode.");
+	ERR_FAIL_COND(!p_src && p_length > 0);
+
+	WRITE_FIT(p_length);
+	memcpy(write_ptr + write_pos, p_src, p_length);
+	write_pos += p_length;
+}
+
 bool FileAccessCompressed::file_exists(const String &p_name) {
 	Ref<FileAccess> fa = FileAccess::open(p_name, FileAccess::READ);
 	if (fa.is_null()) {
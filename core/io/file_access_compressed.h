@@ -33,6 +33,7 @@
 
 #include "core/io/compression.h"
 #include "core/io/file_access.h"
+#include "core/templates/safe_refcount.h"
 
 class FileAccessCompressed : public FileAccess {
 	Compression::Mode cmode = Compression::MODE_ZSTD;
@@ -63,6 +64,35 @@ class FileAccessCompressed : public FileAccess {
 	mutable Vector<uint8_t> buffer;
 	Ref<FileAccess> f;
 
+	// Below this many blocks, compressing or decompressing on the worker pool costs more than it saves.
+	static const uint32_t PARALLEL_MIN_BLOCKS = 4;
+
+	struct BlockTask {
+		const ReadBlock *read_blocks = nullptr;
+		const uint8_t *src = nullptr;
+		uint8_t *dst = nullptr;
+		uint32_t block_size = 0;
+		Compression::Mode mode = Compression::MODE_ZSTD;
+		SafeFlag failed;
+	};
+
+	struct CompressTask {
+		const uint8_t *src = nullptr;
+		uint64_t size = 0;
+		uint32_t block_size = 0;
+		Compression::Mode mode = Compression::MODE_ZSTD;
+		Vector<uint8_t> *cblocks = nullptr;
+	};
+
+	mutable Vector<uint8_t> multi_comp_buffer;
+
+	uint32_t _get_block_size(uint32_t p_block) const;
+	bool _read_block(uint32_t p_block) const;
+	void _next_block() const;
+	bool _decompress_blocks(uint32_t p_first, uint32_t p_count, uint8_t *p_dst) const;
+	static void _decompress_block_task(void *p_userdata, uint32_t p_index);
+	static void _compress_block_task(void *p_userdata, uint32_t p_index);
+
 	void _close();
 
 public:
@@ -70,6 +100,9 @@ public:
 
 	Error open_after_magic(Ref<FileAccess> p_base);
 
+	// Compresses a whole buffer into the same layout written by this class, so it can be read back with open_after_magic().
+	static Vector<uint8_t> compress_buffer(const uint8_t *p_data, uint64_t p_size, const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096);
+
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override; ///< open a file
 	virtual bool is_open() const override; ///< true when file is open
 
@@ -91,6 +124,7 @@ public:
 	virtual Error resize(int64_t p_length) override { return ERR_UNAVAILABLE; }
 	virtual void flush() override;
 	virtual void store_8(uint8_t p_dest) override; ///< store a byte
+	virtual void store_buffer(const uint8_t *p_src, uint64_t p_length) override; ///< store an array of bytes
 
 	virtual bool file_exists(const String &p_name) override; ///< return true if a file exists
 
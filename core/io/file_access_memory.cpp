@@ -75,9 +75,40 @@ Error FileAccessMemory::open_custom(const uint8_t *p_data, uint64_t p_len) {
 	data = (uint8_t *)p_data;
 	length = p_len;
 	pos = 0;
+	growable = false;
+	owned_data.clear();
 	return OK;
 }
 
+Error FileAccessMemory::open_growable() {
+	owned_data.clear();
+	data = nullptr;
+	length = 0;
+	pos = 0;
+	growable = true;
+	return OK;
+}
+
+Vector<uint8_t> FileAccessMemory::get_data() const {
+	ERR_FAIL_COND_V_MSG(!growable, Vector<uint8_t>(), "Only buffers opened with open_growable() own their data.");
+	return owned_data;
+}
+
+bool FileAccessMemory::_fit(uint64_t p_length) {
+	if (pos + p_length <= length) {
+		return true;
+	}
+	if (!growable) {
+		return false;
+	}
+
+	// Vector grows its capacity in powers of two, so this stays cheap for sequential writes.
+	ERR_FAIL_COND_V(owned_data.resize(pos + p_length) != OK, false);
+	data = owned_data.ptrw();
+	length = owned_data.size();
+	return true;
+}
+
 Error FileAccessMemory::open_internal(const String &p_path, int p_mode_flags) {
 	ERR_FAIL_NULL_V(files, ERR_FILE_NOT_FOUND);
 
@@ -95,26 +126,26 @@ Error FileAccessMemory::open_internal(const String &p_path, int p_mode_flags) {
 }
 
 bool FileAccessMemory::is_open() const {
-	return data != nullptr;
+	return data != nullptr || growable;
 }
 
 void FileAccessMemory::seek(uint64_t p_position) {
-	ERR_FAIL_NULL(data);
+	ERR_FAIL_COND(!is_open());
 	pos = p_position;
 }
 
 void FileAccessMemory::seek_end(int64_t p_position) {
-	ERR_FAIL_NULL(data);
+	ERR_FAIL_COND(!is_open());
 	pos = length + p_position;
 }
 
 uint64_t FileAccessMemory::get_position() const {
-	ERR_FAIL_NULL_V(data, 0);
+	ERR_FAIL_COND_V(!is_open(), 0);
 	return pos;
 }
 
 uint64_t FileAccessMemory::get_length() const {
-	ERR_FAIL_NULL_V(data, 0);
+	ERR_FAIL_COND_V(!is_open(), 0);
 	return length;
 }
 
@@ -154,17 +185,21 @@ Error FileAccessMemory::get_error() const {
 }
 
 void FileAccessMemory::flush() {
-	ERR_FAIL_NULL(data);
+	ERR_FAIL_COND(!is_open());
 }
 
 void FileAccessMemory::store_8(uint8_t p_byte) {
-	ERR_FAIL_NULL(data);
-	ERR_FAIL_COND(pos >= length);
+	ERR_FAIL_COND(!is_open());
+	ERR_FAIL_COND(!_fit(1));
 	data[pos++] = p_byte;
 }
 
 void FileAccessMemory::store_buffer(const uint8_t *p_src, uint64_t p_length) {
 	ERR_FAIL_COND(!p_src && p_length > 0);
+	if (p_length == 0) {
+		return;
+	}
+	_fit(p_length);
 	uint64_t left = length - pos;
 	uint64_t write = MIN(p_length, left);
 	if (write < p_length) {
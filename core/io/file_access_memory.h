@@ -38,13 +38,21 @@ class FileAccessMemory : public FileAccess {
 	uint64_t length = 0;
 	mutable uint64_t pos = 0;
 
+	// Backing storage for buffers opened with open_growable().
+	Vector<uint8_t> owned_data;
+	bool growable = false;
+
 	static Ref<FileAccess> create();
 
+	bool _fit(uint64_t p_length);
+
 public:
 	static void register_file(const String &p_name, const Vector<uint8_t> &p_data);
 	static void cleanup();
 
 	virtual Error open_custom(const uint8_t *p_data, uint64_t p_len); ///< open a file
+	Error open_growable(); ///< open an empty buffer that grows as data is stored
+	Vector<uint8_t> get_data() const; ///< get the data stored in a buffer opened with open_growable()
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override; ///< open a file
 	virtual bool is_open() const override; ///< true when file is open
 
@@ -30,7 +30,9 @@
 
 #include "file_access_pack.h"
 
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
+#include "core/io/marshalls.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
 #include "core/version.h"
@@ -38,6 +40,7 @@
 #include <stdio.h>
 
 Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) {
+	mount_serial++;
 	for (int i = 0; i < sources.size(); i++) {
 		if (sources[i]->try_open_pack(p_path, p_replace_files, p_offset)) {
 			return OK;
@@ -47,7 +50,7 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted) {
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_compressed, bool p_defer_dir) {
 	String simplified_path = p_path.simplify_path();
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
@@ -55,6 +58,7 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
+	pf.compressed = p_compressed;
 	pf.pack = p_pkg_path;
 	pf.offset = p_ofs;
 	pf.size = p_size;
@@ -62,50 +66,158 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 		pf.md5[i] = p_md5[i];
 	}
 	pf.src = p_src;
+	pf.replace_files = p_replace_files;
+	pf.mount_serial = mount_serial;
 
 	if (!exists || p_replace_files) {
 		files[pmd5] = pf;
 	}
 
-	if (!exists) {
-		//search for dir
-		String p = simplified_path.replace_first("res://", "");
-		PackedDir *cd = root;
+	if (p_defer_dir) {
+		dirs_pending.set();
+	} else if (!exists) {
+		_add_dir_path(simplified_path);
+	}
+}
 
-		if (p.contains("/")) { //in a subdir
+void PackedData::add_dir_path(const String &p_path) {
+	_add_dir_path(p_path.simplify_path());
+}
 
-			Vector<String> ds = p.get_base_dir().split("/");
+void PackedData::add_pack_index(const String &p_pkg_path, PackSource *p_src, const Vector<uint8_t> &p_entries, uint64_t p_file_base, bool p_replace_files) {
+	PackIndex index;
+	index.pack = p_pkg_path;
+	index.src = p_src;
+	index.entries = p_entries;
+	index.file_base = p_file_base;
+	index.replace_files = p_replace_files;
+	index.mount_serial = mount_serial;
+	indices.push_back(index);
 
-			for (int j = 0; j < ds.size(); j++) {
-				if (!cd->subdirs.has(ds[j])) {
-					PackedDir *pd = memnew(PackedDir);
-					pd->name = ds[j];
-					pd->parent = cd;
-					cd->subdirs[pd->name] = pd;
-					cd = pd;
-				} else {
-					cd = cd->subdirs[ds[j]];
-				}
-			}
+	dirs_pending.set();
+}
+
+const uint8_t *PackedData::PackIndex::find(const uint8_t *p_path_md5) const {
+	const uint8_t *ptr = entries.ptr();
+	uint32_t low = 0;
+	uint32_t high = entries.size() / PACK_INDEX_ENTRY_SIZE;
+	while (low < high) {
+		uint32_t middle = low + (high - low) / 2;
+		const uint8_t *entry = ptr + uint64_t(middle) * PACK_INDEX_ENTRY_SIZE;
+		int cmp = memcmp(entry, p_path_md5, 16);
+		if (cmp == 0) {
+			return entry;
+		} else if (cmp < 0) {
+			low = middle + 1;
+		} else {
+			high = middle;
 		}
-		String filename = simplified_path.get_file();
-		// Don't add as a file if the path points to a directory
-		if (!filename.is_empty()) {
-			cd->files.insert(filename);
+	}
+	return nullptr;
+}
+
+// Packs mounted to replace files override the packs mounted before them,
+// other packs only provide the files that no earlier pack had.
+static bool _pack_overrides(bool p_replace_files, uint32_t p_mount_serial, const PackedData::PackedFile &p_current) {
+	if (p_replace_files) {
+		return !p_current.replace_files || p_mount_serial > p_current.mount_serial;
+	}
+	return !p_current.replace_files && p_mount_serial < p_current.mount_serial;
+}
+
+bool PackedData::_find_file(const String &p_path, PackedFile &r_file) const {
+	Vector<uint8_t> path_md5 = p_path.simplify_path().md5_buffer();
+
+	bool found = false;
+	HashMap<PathMD5, PackedFile, PathMD5>::ConstIterator E = files.find(PathMD5(path_md5));
+	if (E) {
+		r_file = E->value;
+		found = true;
+	}
+
+	for (const PackIndex &index : indices) {
+		if (found && !_pack_overrides(index.replace_files, index.mount_serial, r_file)) {
+			continue;
+		}
+		const uint8_t *entry = index.find(path_md5.ptr());
+		if (!entry) {
+			continue;
 		}
+
+		uint32_t flags = decode_uint32(entry + 48);
+		r_file.pack = index.pack;
+		r_file.offset = index.file_base + decode_uint64(entry + 16);
+		r_file.size = decode_uint64(entry + 24);
+		memcpy(r_file.md5, entry + 32, 16);
+		r_file.src = index.src;
+		r_file.encrypted = flags & PACK_FILE_ENCRYPTED;
+		r_file.compressed = flags & PACK_FILE_COMPRESSED;
+		r_file.replace_files = index.replace_files;
+		r_file.mount_serial = index.mount_serial;
+		found = true;
+	}
+
+	return found;
+}
+
+void PackedData::_add_dir_path(const String &p_simplified_path) {
+	//search for dir
+	String p = p_simplified_path.replace_first("res://", "");
+	PackedDir *cd = root;
+
+	if (p.contains("/")) { //in a subdir
+
+		Vector<String> ds = p.get_base_dir().split("/");
+
+		for (int j = 0; j < ds.size(); j++) {
+			if (!cd->subdirs.has(ds[j])) {
+				PackedDir *pd = memnew(PackedDir);
+				pd->name = ds[j];
+				pd->parent = cd;
+				cd->subdirs[pd->name] = pd;
+				cd = pd;
+			} else {
+				cd = cd->subdirs[ds[j]];
+			}
+		}
+	}
+	String filename = p_simplified_path.get_file();
+	// Don't add as a file if the path points to a directory
+	if (!filename.is_empty()) {
+		cd->files.insert(filename);
 	}
 }
 
 void PackedData::add_pack_source(PackSource *p_source) {
 	if (p_source != nullptr) {
+		p_source->packed_data = this;
 		sources.push_back(p_source);
 	}
 }
 
+void PackedData::_update_dirs() {
+	if (!dirs_pending.is_set()) {
+		return;
+	}
+
+	MutexLock lock(dirs_mutex);
+	if (!dirs_pending.is_set()) {
+		return; // Another thread got here first.
+	}
+	uint64_t start = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < sources.size(); i++) {
+		sources[i]->add_pending_dirs();
+	}
+	dirs_pending.clear();
+	print_verbose(vformat("Built the directory tree of packs in %d ms.", (OS::get_singleton()->get_ticks_usec() - start) / 1000));
+}
+
 PackedData *PackedData::singleton = nullptr;
 
 PackedData::PackedData() {
-	singleton = this;
+	if (!singleton) {
+		singleton = this;
+	}
 	root = memnew(PackedDir);
 
 	add_pack_source(memnew(PackedSourcePCK));
@@ -123,11 +235,19 @@ PackedData::~PackedData() {
 		memdelete(sources[i]);
 	}
 	_free_packed_dirs(root);
+
+	if (singleton == this) {
+		singleton = nullptr;
+	}
 }
 
 //////////////////////////////////////////////////////////////////
 
 bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) {
+#ifdef DEBUG_ENABLED
+	uint64_t mount_start = OS::get_singleton()->get_ticks_usec();
+#endif
+
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
 	if (f.is_null()) {
 		return false;
@@ -212,61 +332,165 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	bool enc_directory = (pack_flags & PACK_DIR_ENCRYPTED);
 	bool rel_filebase = (pack_flags & PACK_REL_FILEBASE);
 
-	for (int i = 0; i < 16; i++) {
+	uint64_t index_offset = f->get_64();
+	for (int i = 2; i < 16; i++) {
 		//reserved
 		f->get_32();
 	}
 
 	int file_count = f->get_32();
+	uint64_t table_offset = f->get_position();
 
 	if (rel_filebase) {
 		file_base += pck_start_pos;
 	}
 
-	if (enc_directory) {
-		Ref<FileAccessEncrypted> fae;
-		fae.instantiate();
-		ERR_FAIL_COND_V_MSG(fae.is_null(), false, "Can't open encrypted pack directory.");
+	if ((pack_flags & PACK_HASHED_INDEX) && !enc_directory) {
+		// Only the index is read now, files are looked up in it when opened.
+		f->seek(pck_start_pos + index_offset);
+		uint32_t entry_count = f->get_32();
+		Vector<uint8_t> entries;
+		entries.resize(uint64_t(entry_count) * PACK_INDEX_ENTRY_SIZE);
+		ERR_FAIL_COND_V_MSG(f->get_buffer(entries.ptrw(), entries.size()) != uint64_t(entries.size()), false, "Can't read the index of pack '" + p_path + "'.");
 
-		Vector<uint8_t> key;
-		key.resize(32);
-		for (int i = 0; i < key.size(); i++) {
-			key.write[i] = script_encryption_key[i];
-		}
+		packed_data->add_pack_index(p_path, this, entries, file_base + p_offset, p_replace_files);
+	} else {
+		if (enc_directory) {
+			Ref<FileAccessEncrypted> fae;
+			fae.instantiate();
+			ERR_FAIL_COND_V_MSG(fae.is_null(), false, "Can't open encrypted pack directory.");
+
+			Vector<uint8_t> key;
+			key.resize(32);
+			for (int i = 0; i < key.size(); i++) {
+				key.write[i] = script_encryption_key[i];
+			}
 
-		Error err = fae->open_and_parse(f, key, FileAccessEncrypted::MODE_READ, false);
-		ERR_FAIL_COND_V_MSG(err, false, "Can't open encrypted pack directory.");
-		f = fae;
-	}
+			Error err = fae->open_and_parse(f, key, FileAccessEncrypted::MODE_READ, false);
+			ERR_FAIL_COND_V_MSG(err, false, "Can't open encrypted pack directory.");
+			f = fae;
+		}
 
-	for (int i = 0; i < file_count; i++) {
-		uint32_t sl = f->get_32();
-		CharString cs;
-		cs.resize(sl + 1);
-		f->get_buffer((uint8_t *)cs.ptr(), sl);
-		cs[sl] = 0;
+		for (int i = 0; i < file_count; i++) {
+			uint32_t sl = f->get_32();
+			CharString cs;
+			cs.resize(sl + 1);
+			f->get_buffer((uint8_t *)cs.ptr(), sl);
+			cs[sl] = 0;
 
-		String path;
-		path.parse_utf8(cs.ptr());
+			String path;
+			path.parse_utf8(cs.ptr());
 
-		uint64_t ofs = file_base + f->get_64();
-		uint64_t size = f->get_64();
-		uint8_t md5[16];
-		f->get_buffer(md5, 16);
-		uint32_t flags = f->get_32();
+			uint64_t ofs = file_base + f->get_64();
+			uint64_t size = f->get_64();
+			uint8_t md5[16];
+			f->get_buffer(md5, 16);
+			uint32_t flags = f->get_32();
 
-		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
+			packed_data->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), (flags & PACK_FILE_COMPRESSED), true);
+		}
 	}
 
+	PendingDirs pd;
+	pd.pack_path = p_path;
+	pd.table_offset = table_offset;
+	pd.file_count = file_count;
+	pd.encrypted = enc_directory;
+	pending_dirs.push_back(pd);
+
+#ifdef DEBUG_ENABLED
+	print_verbose(vformat("Mounted pack '%s' with %d files in %d ms.", p_path, file_count, (OS::get_singleton()->get_ticks_usec() - mount_start) / 1000));
+#endif
+
 	return true;
 }
 
+void PackedSourcePCK::add_pending_dirs() {
+	for (const PendingDirs &pd : pending_dirs) {
+		Ref<FileAccess> f = FileAccess::open(pd.pack_path, FileAccess::READ);
+		ERR_CONTINUE_MSG(f.is_null(), "Can't reopen pack '" + pd.pack_path + "' to read its directories.");
+		f->seek(pd.table_offset);
+
+		if (pd.encrypted) {
+			Ref<FileAccessEncrypted> fae;
+			fae.instantiate();
+
+			Vector<uint8_t> key;
+			key.resize(32);
+			for (int i = 0; i < key.size(); i++) {
+				key.write[i] = script_encryption_key[i];
+			}
+
+			Error err = fae->open_and_parse(f, key, FileAccessEncrypted::MODE_READ, false);
+			ERR_CONTINUE_MSG(err, "Can't open encrypted pack directory.");
+			f = fae;
+		}
+
+		CharString cs;
+		for (uint32_t i = 0; i < pd.file_count; i++) {
+			uint32_t sl = f->get_32();
+			cs.resize(sl + 1);
+			f->get_buffer((uint8_t *)cs.ptr(), sl);
+			cs[sl] = 0;
+			f->seek(f->get_position() + 8 + 8 + 16 + 4); // Offset, size, MD5 and flags.
+
+			String path;
+			path.parse_utf8(cs.ptr());
+			packed_data->add_dir_path(path);
+		}
+	}
+	pending_dirs.clear();
+}
+
 Ref<FileAccess> PackedSourcePCK::get_file(const String &p_path, PackedData::PackedFile *p_file) {
 	return memnew(FileAccessPack(p_path, *p_file));
 }
 
 //////////////////////////////////////////////////////////////////
 
+void PackIndexWriter::add_file(const String &p_path, uint64_t p_offset, uint64_t p_size, const uint8_t *p_md5, uint32_t p_flags) {
+	Entry entry;
+	Vector<uint8_t> path_md5 = p_path.simplify_path().md5_buffer();
+	memcpy(entry.path_md5, path_md5.ptr(), 16);
+	entry.offset = p_offset;
+	entry.size = p_size;
+	memcpy(entry.md5, p_md5, 16);
+	entry.flags = p_flags;
+	entry.order = entries.size();
+	entries.push_back(entry);
+}
+
+void PackIndexWriter::store(Ref<FileAccess> p_file) {
+	struct EntryComparator {
+		_FORCE_INLINE_ bool operator()(const Entry &p_a, const Entry &p_b) const {
+			int cmp = memcmp(p_a.path_md5, p_b.path_md5, 16);
+			return cmp < 0 || (cmp == 0 && p_a.order < p_b.order);
+		}
+	};
+	entries.sort_custom<EntryComparator>();
+
+	uint32_t count = 0;
+	for (uint32_t i = 0; i < entries.size(); i++) {
+		if (i + 1 == entries.size() || memcmp(entries[i].path_md5, entries[i + 1].path_md5, 16) != 0) {
+			count++;
+		}
+	}
+
+	p_file->store_32(count);
+	for (uint32_t i = 0; i < entries.size(); i++) {
+		if (i + 1 < entries.size() && memcmp(entries[i].path_md5, entries[i + 1].path_md5, 16) == 0) {
+			continue; // Added again later.
+		}
+		p_file->store_buffer(entries[i].path_md5, 16);
+		p_file->store_64(entries[i].offset);
+		p_file->store_64(entries[i].size);
+		p_file->store_buffer(entries[i].md5, 16);
+		p_file->store_32(entries[i].flags);
+	}
+}
+
+//////////////////////////////////////////////////////////////////
+
 Error FileAccessPack::open_internal(const String &p_path, int p_mode_flags) {
 	ERR_PRINT("Can't open pack-referenced file.");
 	return ERR_UNAVAILABLE;
@@ -344,6 +568,21 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return to_read;
 }
 
+const uint8_t *FileAccessPack::get_buffer_view(uint64_t p_length) const {
+	ERR_FAIL_COND_V_MSG(f.is_null(), nullptr, "File must be opened before use.");
+
+	if (eof || pos + p_length > pf.size) {
+		return nullptr;
+	}
+
+	// The pack file access is kept at the same position, so this points straight into the pack.
+	const uint8_t *view = f->get_buffer_view(p_length);
+	if (view) {
+		pos += p_length;
+	}
+	return view;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
@@ -402,6 +641,26 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
+
+	if (pf.compressed) {
+		// Compression is applied before encryption, so this reads through the decrypted stream.
+		char magic[5] = {};
+		f->get_buffer((uint8_t *)magic, 4);
+		if (String(magic) != PACK_COMPRESSION_MAGIC) {
+			f.unref();
+			ERR_FAIL_MSG("Compressed pack-referenced file in '" + String(pf.pack) + "' is corrupt.");
+		}
+
+		Ref<FileAccessCompressed> fac;
+		fac.instantiate();
+		Error err = fac->open_after_magic(f);
+		if (err != OK) {
+			f.unref();
+			ERR_FAIL_MSG("Can't open compressed pack-referenced file in '" + String(pf.pack) + "'.");
+		}
+		f = fac;
+		off = 0;
+	}
 	pos = 0;
 	eof = false;
 }
@@ -411,6 +670,7 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 //////////////////////////////////////////////////////////////////////////////////
 
 Error DirAccessPack::list_dir_begin() {
+	PackedData::get_singleton()->_update_dirs();
 	list_dirs.clear();
 	list_files.clear();
 
@@ -463,6 +723,7 @@ String DirAccessPack::get_drive(int p_drive) {
 }
 
 PackedData::PackedDir *DirAccessPack::_find_dir(const String &p_dir) {
+	PackedData::get_singleton()->_update_dirs();
 	String nd = p_dir.replace("\\", "/");
 
 	// Special handling since simplify_path() will forbid it
@@ -575,5 +836,6 @@ String DirAccessPack::get_filesystem_type() const {
 }
 
 DirAccessPack::DirAccessPack() {
+	PackedData::get_singleton()->_update_dirs();
 	current = PackedData::get_singleton()->root;
 }
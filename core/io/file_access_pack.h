@@ -33,9 +33,11 @@
 
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 
 // Godot's packed file magic header ("GDPC" in ASCII).
@@ -46,12 +48,23 @@
 enum PackFlags {
 	PACK_DIR_ENCRYPTED = 1 << 0,
 	PACK_REL_FILEBASE = 1 << 1,
+	PACK_HASHED_INDEX = 1 << 2, // The first two reserved header words hold the offset of a PackIndexWriter index.
 };
 
 enum PackFileFlags {
-	PACK_FILE_ENCRYPTED = 1 << 0
+	PACK_FILE_ENCRYPTED = 1 << 0,
+	PACK_FILE_COMPRESSED = 1 << 1, // Stored in FileAccessCompressed layout, see PACK_COMPRESSION_MAGIC.
 };
 
+// Magic of files stored with PACK_FILE_COMPRESSED.
+#define PACK_COMPRESSION_MAGIC "GCPF"
+// Block size used when compressing files into a pack. Larger than FileAccessCompressed's default for a better ratio.
+#define PACK_COMPRESSION_BLOCK_SIZE (64 * 1024)
+// Smaller files are always stored as is, the savings would not make up for the block table.
+#define PACK_COMPRESSION_MIN_SIZE 4096
+// Size of an entry in a pack's hashed index: path MD5 (16), offset (8), size (8), file MD5 (16) and flags (4).
+#define PACK_INDEX_ENTRY_SIZE 52
+
 class PackSource;
 
 class PackedData {
@@ -67,6 +80,22 @@ public:
 		uint8_t md5[16];
 		PackSource *src = nullptr;
 		bool encrypted;
+		bool compressed = false;
+		bool replace_files = false; // Whether the pack it comes from was mounted to replace files.
+		uint32_t mount_serial = 0;
+	};
+
+	// Files of packs with a hashed index aren't added to the files map when mounting.
+	// Instead, they are looked up in the index, which is kept as read from the pack.
+	struct PackIndex {
+		String pack;
+		PackSource *src = nullptr;
+		Vector<uint8_t> entries; // PACK_INDEX_ENTRY_SIZE bytes each, sorted by path MD5.
+		uint64_t file_base = 0;
+		bool replace_files = false;
+		uint32_t mount_serial = 0;
+
+		const uint8_t *find(const uint8_t *p_path_md5) const;
 	};
 
 private:
@@ -98,19 +127,29 @@ private:
 	};
 
 	HashMap<PathMD5, PackedFile, PathMD5> files;
+	LocalVector<PackIndex> indices;
+	uint32_t mount_serial = 0;
 
 	Vector<PackSource *> sources;
 
 	PackedDir *root = nullptr;
+	// The directory tree is only needed for DirAccess, so sources may defer adding to it until then.
+	SafeFlag dirs_pending;
+	Mutex dirs_mutex;
 
 	static PackedData *singleton;
 	bool disabled = false;
 
 	void _free_packed_dirs(PackedDir *p_dir);
+	void _add_dir_path(const String &p_simplified_path);
+	void _update_dirs();
+	bool _find_file(const String &p_path, PackedFile &r_file) const;
 
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false); // for PackSource
+	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_compressed = false, bool p_defer_dir = false); // for PackSource
+	void add_dir_path(const String &p_path); // for PackSource, to add paths that were deferred in add_path()
+	void add_pack_index(const String &p_pkg_path, PackSource *p_src, const Vector<uint8_t> &p_entries, uint64_t p_file_base, bool p_replace_files); // for PackSource, paths are added with add_dir_path()
 
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
@@ -124,21 +163,56 @@ public:
 	_FORCE_INLINE_ Ref<DirAccess> try_open_directory(const String &p_path);
 	_FORCE_INLINE_ bool has_directory(const String &p_path);
 
+	// Only the first PackedData is the singleton, others can be used to read packs without mounting them for everyone.
 	PackedData();
 	~PackedData();
 };
 
 class PackSource {
+	friend class PackedData;
+
+protected:
+	PackedData *packed_data = nullptr; // The PackedData this source was added to.
+
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) = 0;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file) = 0;
+	virtual void add_pending_dirs() {}
 	virtual ~PackSource() {}
 };
 
 class PackedSourcePCK : public PackSource {
+	// Where to find the file table of a mounted pack again, to read its paths into the directory tree.
+	struct PendingDirs {
+		String pack_path;
+		uint64_t table_offset = 0;
+		uint32_t file_count = 0;
+		bool encrypted = false;
+	};
+	LocalVector<PendingDirs> pending_dirs;
+
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) override;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file) override;
+	virtual void add_pending_dirs() override;
+};
+
+// Builds the hashed index that PACK_HASHED_INDEX packs store after their file table.
+class PackIndexWriter {
+	struct Entry {
+		uint8_t path_md5[16] = {};
+		uint64_t offset = 0;
+		uint64_t size = 0;
+		uint8_t md5[16] = {};
+		uint32_t flags = 0;
+		uint32_t order = 0;
+	};
+	LocalVector<Entry> entries;
+
+public:
+	// p_offset is relative to the file base, like in the file table. If a path is added twice, the last one is kept.
+	void add_file(const String &p_path, uint64_t p_offset, uint64_t p_size, const uint8_t *p_md5, uint32_t p_flags);
+	void store(Ref<FileAccess> p_file);
 };
 
 class FileAccessPack : public FileAccess {
@@ -172,6 +246,7 @@ public:
 	virtual uint8_t get_8() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
@@ -191,21 +266,34 @@ public:
 };
 
 Ref<FileAccess> PackedData::try_open_path(const String &p_path) {
-	String simplified_path = p_path.simplify_path();
-	PathMD5 pmd5(simplified_path.md5_buffer());
-	HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(pmd5);
-	if (!E) {
-		return nullptr; //not found
-	}
-	if (E->value.offset == 0) {
-		return nullptr; //was erased
+	if (indices.is_empty()) {
+		String simplified_path = p_path.simplify_path();
+		PathMD5 pmd5(simplified_path.md5_buffer());
+		HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(pmd5);
+		if (!E) {
+			return nullptr; //not found
+		}
+		if (E->value.offset == 0) {
+			return nullptr; //was erased
+		}
+
+		return E->value.src->get_file(p_path, &E->value);
 	}
 
-	return E->value.src->get_file(p_path, &E->value);
+	PackedFile pf;
+	if (!_find_file(p_path, pf) || pf.offset == 0) {
+		return nullptr;
+	}
+	return pf.src->get_file(p_path, &pf);
 }
 
 bool PackedData::has_path(const String &p_path) {
-	return files.has(PathMD5(p_path.simplify_path().md5_buffer()));
+	if (indices.is_empty()) {
+		return files.has(PathMD5(p_path.simplify_path().md5_buffer()));
+	}
+
+	PackedFile pf;
+	return _find_file(p_path, pf);
 }
 
 bool PackedData::has_directory(const String &p_path) {
@@ -32,8 +32,10 @@
 
 #include "core/crypto/crypto_core.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
-#include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
+#include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION, PACK_COMPRESSION_*
+#include "core/templates/hash_set.h"
 #include "core/version.h"
 
 static int _get_pad(int p_alignment, int p_n) {
@@ -50,6 +52,8 @@ void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_name", "alignment", "key", "encrypt_directory"), &PCKPacker::pck_start, DEFVAL(32), DEFVAL("0000000000000000000000000000000000000000000000000000000000000000"), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file", "pck_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("set_compress_files", "enabled"), &PCKPacker::set_compress_files);
+	ClassDB::bind_method(D_METHOD("is_compress_files_enabled"), &PCKPacker::is_compress_files_enabled);
 }
 
 Error PCKPacker::pck_start(const String &p_file, int p_alignment, const String &p_key, bool p_encrypt_directory) {
@@ -97,11 +101,14 @@ Error PCKPacker::pck_start(const String &p_file, int p_alignment, const String &
 	uint32_t pack_flags = 0;
 	if (enc_dir) {
 		pack_flags |= PACK_DIR_ENCRYPTED;
+	} else {
+		// The index would give away the layout that encrypting the directory hides.
+		pack_flags |= PACK_HASHED_INDEX;
 	}
 	file->store_32(pack_flags); // flags
 
 	files.clear();
-	ofs = 0;
+	stored_contents.clear();
 
 	return OK;
 }
@@ -119,7 +126,6 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 	// symbols in them still match to the MD5 hash for the saved path.
 	pf.path = p_file.simplify_path();
 	pf.src_path = p_src;
-	pf.ofs = ofs;
 	pf.size = f->get_length();
 
 	Vector<uint8_t> data = FileAccess::get_file_as_bytes(p_src);
@@ -133,20 +139,72 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 	}
 	pf.encrypted = p_encrypt;
 
-	uint64_t _size = pf.size;
-	if (p_encrypt) { // Add encryption overhead.
-		if (_size % 16) { // Pad to encryption block size.
-			_size += 16 - (_size % 16);
+	// Files with identical contents point to the same data, which is only stored once.
+	const String content_key = String::hex_encode_buffer(pf.md5.ptr(), 16) + "-" + itos(pf.size) + (p_encrypt ? "-e" : "");
+	HashMap<String, int>::ConstIterator E = stored_contents.find(content_key);
+	if (E) {
+		pf.duplicate_of = E->value;
+	} else {
+		stored_contents[content_key] = files.size();
+	}
+
+	files.push_back(pf);
+
+	return OK;
+}
+
+void PCKPacker::set_compress_files(bool p_enabled) {
+	compress_files = p_enabled;
+}
+
+bool PCKPacker::is_compress_files_enabled() const {
+	return compress_files;
+}
+
+Error PCKPacker::_store_file_data(File &p_file, uint8_t *p_buf, uint32_t p_buf_max) {
+	Ref<FileAccess> src = FileAccess::open(p_file.src_path, FileAccess::READ);
+	ERR_FAIL_COND_V_MSG(src.is_null(), ERR_FILE_CANT_OPEN, "Can't open source file: " + p_file.src_path + ".");
+
+	// Only the file being stored is compressed, so at most one file is held in memory.
+	Vector<uint8_t> compressed_data;
+	if (compress_files && p_file.size >= PACK_COMPRESSION_MIN_SIZE) {
+		Vector<uint8_t> data = src->get_buffer(p_file.size);
+		compressed_data = FileAccessCompressed::compress_buffer(data.ptr(), data.size(), PACK_COMPRESSION_MAGIC, Compression::MODE_ZSTD, PACK_COMPRESSION_BLOCK_SIZE);
+		// Not worth paying for decompression on load if it barely shrinks.
+		if (compressed_data.is_empty() || compressed_data.size() > data.size() - data.size() / 8) {
+			compressed_data.clear();
+			src->seek(0);
 		}
-		_size += 16; // hash
-		_size += 8; // data size
-		_size += 16; // iv
+	}
+	p_file.compressed = !compressed_data.is_empty();
+
+	Ref<FileAccessEncrypted> fae;
+	Ref<FileAccess> ftmp = file;
+	if (p_file.encrypted) {
+		fae.instantiate();
+		ERR_FAIL_COND_V(fae.is_null(), ERR_CANT_CREATE);
+
+		Error err = fae->open_and_parse(file, key, FileAccessEncrypted::MODE_WRITE_AES256, false);
+		ERR_FAIL_COND_V(err != OK, ERR_CANT_CREATE);
+		ftmp = fae;
 	}
 
-	int pad = _get_pad(alignment, ofs + _size);
-	ofs = ofs + _size + pad;
+	if (p_file.compressed) {
+		ftmp->store_buffer(compressed_data);
+	} else {
+		uint64_t to_write = p_file.size;
+		while (to_write > 0) {
+			uint64_t read = src->get_buffer(p_buf, MIN(to_write, p_buf_max));
+			ERR_FAIL_COND_V_MSG(read == 0, ERR_FILE_CORRUPT, "Source file changed while packing: " + p_file.src_path + ".");
+			ftmp->store_buffer(p_buf, read);
+			to_write -= read;
+		}
+	}
 
-	files.push_back(pf);
+	if (fae.is_valid()) {
+		ftmp.unref();
+		fae.unref();
+	}
 
 	return OK;
 }
@@ -154,8 +212,72 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 Error PCKPacker::flush(bool p_verbose) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
+	// The directory goes before the file data but needs the offsets of the stored files,
+	// so room is left for it and it is written once all the data is in place.
+	uint64_t dir_size = 0;
+	for (int i = 0; i < files.size(); i++) {
+		int string_len = files[i].path.utf8().length();
+		dir_size += 4 + string_len + _get_pad(4, string_len) + 8 + 8 + 16 + 4;
+	}
+	if (enc_dir) { // Add encryption overhead.
+		if (dir_size % 16) {
+			dir_size += 16 - (dir_size % 16);
+		}
+		dir_size += 16 + 8 + 16; // hash, data size and iv
+	}
+
+	PackIndexWriter index;
+	if (!enc_dir) {
+		HashSet<String> index_paths;
+		for (int i = 0; i < files.size(); i++) {
+			index_paths.insert(files[i].path);
+		}
+		dir_size += 4 + (uint64_t)index_paths.size() * PACK_INDEX_ENTRY_SIZE;
+	}
+
 	int64_t file_base_ofs = file->get_position();
-	file->store_64(0); // files base
+	uint64_t header_end = file_base_ofs + 8 + 16 * 4 + 4 + dir_size;
+	int64_t file_base = header_end + _get_pad(alignment, header_end);
+
+	const uint32_t buf_max = 65536;
+	uint8_t *buf = memnew_arr(uint8_t, buf_max);
+
+	memset(buf, 0, buf_max);
+	for (int64_t to_fill = file_base - file_base_ofs; to_fill > 0; to_fill -= buf_max) {
+		file->store_buffer(buf, MIN(to_fill, (int64_t)buf_max));
+	}
+
+	int count = 0;
+	for (int i = 0; i < files.size(); i++) {
+		count += 1;
+		if (files[i].duplicate_of >= 0) {
+			files.write[i].ofs = files[files[i].duplicate_of].ofs;
+			files.write[i].compressed = files[files[i].duplicate_of].compressed;
+			continue;
+		}
+
+		files.write[i].ofs = file->get_position() - file_base;
+		Error err = _store_file_data(files.write[i], buf, buf_max);
+		if (err != OK) {
+			memdelete_arr(buf);
+			return err;
+		}
+
+		int pad = _get_pad(alignment, file->get_position());
+		for (int j = 0; j < pad; j++) {
+			file->store_8(0);
+		}
+
+		const int file_num = files.size();
+		if (p_verbose && (file_num > 0)) {
+			print_line(vformat("[%d/%d - %d%%] PCKPacker flush: %s -> %s", count, file_num, float(count) / file_num * 100, files[i].src_path, files[i].path));
+		}
+	}
+
+	memdelete_arr(buf);
+
+	file->seek(file_base_ofs);
+	file->store_64(file_base); // files base
 
 	for (int i = 0; i < 16; i++) {
 		file->store_32(0); // reserved
@@ -195,7 +317,14 @@ Error PCKPacker::flush(bool p_verbose) {
 		if (files[i].encrypted) {
 			flags |= PACK_FILE_ENCRYPTED;
 		}
+		if (files[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
+
+		if (!enc_dir) {
+			index.add_file(files[i].path, files[i].ofs, files[i].size, files[i].md5.ptr(), flags);
+		}
 	}
 
 	if (fae.is_valid()) {
@@ -203,59 +332,18 @@ Error PCKPacker::flush(bool p_verbose) {
 		fae.unref();
 	}
 
-	int header_padding = _get_pad(alignment, file->get_position());
-	for (int i = 0; i < header_padding; i++) {
-		file->store_8(0);
+	if (!enc_dir) {
+		uint64_t index_ofs = file->get_position();
+		index.store(file);
+		uint64_t index_end = file->get_position();
+		file->seek(file_base_ofs + 8);
+		file->store_64(index_ofs); // The first reserved words, relative to the pack start.
+		file->seek(index_end);
 	}
 
-	int64_t file_base = file->get_position();
-	file->seek(file_base_ofs);
-	file->store_64(file_base); // update files base
-	file->seek(file_base);
-
-	const uint32_t buf_max = 65536;
-	uint8_t *buf = memnew_arr(uint8_t, buf_max);
-
-	int count = 0;
-	for (int i = 0; i < files.size(); i++) {
-		Ref<FileAccess> src = FileAccess::open(files[i].src_path, FileAccess::READ);
-		uint64_t to_write = files[i].size;
-
-		Ref<FileAccess> ftmp = file;
-		if (files[i].encrypted) {
-			fae.instantiate();
-			ERR_FAIL_COND_V(fae.is_null(), ERR_CANT_CREATE);
-
-			Error err = fae->open_and_parse(file, key, FileAccessEncrypted::MODE_WRITE_AES256, false);
-			ERR_FAIL_COND_V(err != OK, ERR_CANT_CREATE);
-			ftmp = fae;
-		}
-
-		while (to_write > 0) {
-			uint64_t read = src->get_buffer(buf, MIN(to_write, buf_max));
-			ftmp->store_buffer(buf, read);
-			to_write -= read;
-		}
-
-		if (fae.is_valid()) {
-			ftmp.unref();
-			fae.unref();
-		}
-
-		int pad = _get_pad(alignment, file->get_position());
-		for (int j = 0; j < pad; j++) {
-			file->store_8(0);
-		}
-
-		count += 1;
-		const int file_num = files.size();
-		if (p_verbose && (file_num > 0)) {
-			print_line(vformat("[%d/%d - %d%%] PCKPacker flush: %s -> %s", count, file_num, float(count) / file_num * 100, files[i].src_path, files[i].path));
-		}
-	}
+	ERR_FAIL_COND_V_MSG(file->get_position() > (uint64_t)file_base, ERR_BUG, "PCK directory overflowed the space reserved for it.");
 
 	file.unref();
-	memdelete_arr(buf);
 
 	return OK;
 }
@@ -32,6 +32,7 @@
 #define PCK_PACKER_H
 
 #include "core/object/ref_counted.h"
+#include "core/templates/hash_map.h"
 
 class FileAccess;
 
@@ -40,10 +41,10 @@ class PCKPacker : public RefCounted {
 
 	Ref<FileAccess> file;
 	int alignment = 0;
-	uint64_t ofs = 0;
 
 	Vector<uint8_t> key;
 	bool enc_dir = false;
+	bool compress_files = false;
 
 	static void _bind_methods();
 
@@ -53,13 +54,20 @@ class PCKPacker : public RefCounted {
 		uint64_t ofs = 0;
 		uint64_t size = 0;
 		bool encrypted = false;
+		bool compressed = false;
+		int duplicate_of = -1; // Index of an earlier file with the same contents, whose data is shared.
 		Vector<uint8_t> md5;
 	};
 	Vector<File> files;
+	HashMap<String, int> stored_contents; // Content key to the index in files where that data is stored.
+
+	Error _store_file_data(File &p_file, uint8_t *p_buf, uint32_t p_buf_max);
 
 public:
 	Error pck_start(const String &p_file, int p_alignment = 32, const String &p_key = "0000000000000000000000000000000000000000000000000000000000000000", bool p_encrypt_directory = false);
 	Error add_file(const String &p_file, const String &p_src, bool p_encrypt = false);
+	void set_compress_files(bool p_enabled);
+	bool is_compress_files_enabled() const;
 	Error flush(bool p_verbose = false);
 
 	PCKPacker() {}
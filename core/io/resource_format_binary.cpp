@@ -33,10 +33,12 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/image.h"
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 
 //#define print_bl(m_what) print_line(m_what)
@@ -163,8 +165,13 @@ StringName ResourceLoaderBinary::_get_string() {
 		if (len == 0) {
 			return StringName();
 		}
-		f->get_buffer((uint8_t *)&str_buf[0], len);
 		String s;
+		const uint8_t *view = f->get_buffer_view(len);
+		if (view) {
+			s.parse_utf8((const char *)view, len);
+			return s;
+		}
+		f->get_buffer((uint8_t *)&str_buf[0], len);
 		s.parse_utf8(&str_buf[0]);
 		return s;
 	}
@@ -680,189 +687,346 @@ Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
 
-Error ResourceLoaderBinary::load() {
-	if (error != OK) {
-		return error;
-	}
+Error ResourceLoaderBinary::_create_internal_resource(int p_index, Ref<Resource> &r_res, MissingResource *&r_missing_resource, bool &r_cached) {
+	bool main = p_index == (internal_resources.size() - 1);
 
-	for (int i = 0; i < external_resources.size(); i++) {
-		String path = external_resources[i].path;
+	//maybe it is loaded already
+	String path;
+	String id;
 
-		if (remaps.has(path)) {
-			path = remaps[path];
-		}
+	if (!main) {
+		path = internal_resources[p_index].path;
 
-		if (!path.contains("://") && path.is_relative_path()) {
-			// path is relative to file being loaded, so convert to a resource path
-			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
+		if (path.begins_with("local://")) {
+			path = path.replace_first("local://", "");
+			id = path;
+			path = res_path + "::" + path;
+
+			internal_resources.write[p_index].path = path; // Update path.
 		}
 
-		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
-		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
-		if (!external_resources[i].load_token.is_valid()) {
-			if (!ResourceLoader::get_abort_on_missing_resources()) {
-				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
-			} else {
-				error = ERR_FILE_MISSING_DEPENDENCIES;
-				ERR_FAIL_V_MSG(error, "Can't load dependency: " + path + ".");
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached.is_valid()) {
+				//already loaded, don't do anything
+				internal_index_cache[path] = cached;
+				r_cached = true;
+				return OK;
 			}
 		}
+	} else {
+		if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
+			path = res_path;
+		}
 	}
 
-	for (int i = 0; i < internal_resources.size(); i++) {
-		bool main = i == (internal_resources.size() - 1);
+	uint64_t offset = internal_resources[p_index].offset;
 
-		//maybe it is loaded already
-		String path;
-		String id;
+	f->seek(offset);
 
-		if (!main) {
-			path = internal_resources[i].path;
+	String t = get_unicode_string();
 
-			if (path.begins_with("local://")) {
-				path = path.replace_first("local://", "");
-				id = path;
-				path = res_path + "::" + path;
+	Ref<Resource> res;
 
-				internal_resources.write[i].path = path; // Update path.
-			}
+	if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
+		//use the existing one
+		Ref<Resource> cached = ResourceCache::get_ref(path);
+		if (cached->get_class() == t) {
+			cached->reset_state();
+			res = cached;
+		}
+	}
 
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached.is_valid()) {
-					//already loaded, don't do anything
-					error = OK;
-					internal_index_cache[path] = cached;
-					continue;
-				}
+	if (res.is_null()) {
+		//did not replace
+
+		Object *obj = ClassDB::instantiate(t);
+		if (!obj) {
+			if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+				//create a missing resource
+				r_missing_resource = memnew(MissingResource);
+				r_missing_resource->set_original_class(t);
+				r_missing_resource->set_recording_properties(true);
+				obj = r_missing_resource;
+			} else {
+				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource of unrecognized type in file: " + t + ".");
 			}
-		} else {
-			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
-				path = res_path;
+		}
+
+		Resource *r = Object::cast_to<Resource>(obj);
+		if (!r) {
+			String obj_class = obj->get_class();
+			memdelete(obj); //bye
+			ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource type in resource field not a resource, type is: " + obj_class + ".");
+		}
+
+		res = Ref<Resource>(r);
+		if (!path.is_empty()) {
+			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
+				r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
+			} else {
+				r->set_path_cache(path);
 			}
 		}
+		r->set_scene_unique_id(id);
+	}
 
-		uint64_t offset = internal_resources[i].offset;
+	if (!main) {
+		internal_index_cache[path] = res;
+	}
 
-		f->seek(offset);
+	r_res = res;
+	return OK;
+}
 
-		String t = get_unicode_string();
+// Reads the property list of the resource the file is positioned at.
+Error ResourceLoaderBinary::_parse_properties(Vector<Pair<StringName, Variant>> &r_properties) {
+	int pc = f->get_32();
+	r_properties.resize(pc);
+	Pair<StringName, Variant> *w = r_properties.ptrw();
 
-		Ref<Resource> res;
+	for (int j = 0; j < pc; j++) {
+		w[j].first = _get_string();
 
-		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
-			//use the existing one
-			Ref<Resource> cached = ResourceCache::get_ref(path);
-			if (cached->get_class() == t) {
-				cached->reset_state();
-				res = cached;
-			}
+		if (w[j].first == StringName()) {
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
 		}
 
-		MissingResource *missing_resource = nullptr;
+		Error err = parse_variant(w[j].second);
+		if (err) {
+			return err;
+		}
+	}
 
-		if (res.is_null()) {
-			//did not replace
-
-			Object *obj = ClassDB::instantiate(t);
-			if (!obj) {
-				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-					//create a missing resource
-					missing_resource = memnew(MissingResource);
-					missing_resource->set_original_class(t);
-					missing_resource->set_recording_properties(true);
-					obj = missing_resource;
-				} else {
-					error = ERR_FILE_CORRUPT;
-					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource of unrecognized type in file: " + t + ".");
-				}
-			}
+	return OK;
+}
+
+void ResourceLoaderBinary::_set_properties(const Ref<Resource> &p_res, MissingResource *p_missing_resource, const Vector<Pair<StringName, Variant>> &p_properties) {
+	Dictionary missing_resource_properties;
+
+	for (const Pair<StringName, Variant> &E : p_properties) {
+		const StringName &name = E.first;
+		Variant value = E.second;
 
-			Resource *r = Object::cast_to<Resource>(obj);
-			if (!r) {
-				String obj_class = obj->get_class();
-				error = ERR_FILE_CORRUPT;
-				memdelete(obj); //bye
-				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource type in resource field not a resource, type is: " + obj_class + ".");
+		bool set_valid = true;
+		if (value.get_type() == Variant::OBJECT && p_missing_resource != nullptr) {
+			// If the property being set is a missing resource (and the parent is not),
+			// then setting it will most likely not work.
+			// Instead, save it as metadata.
+
+			Ref<MissingResource> mr = value;
+			if (mr.is_valid()) {
+				missing_resource_properties[name] = mr;
+				set_valid = false;
 			}
+		}
 
-			res = Ref<Resource>(r);
-			if (!path.is_empty()) {
-				if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
-					r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
-				} else {
-					r->set_path_cache(path);
+		if (value.get_type() == Variant::ARRAY) {
+			Array set_array = value;
+			bool is_get_valid = false;
+			Variant get_value = p_res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+				Array get_array = get_value;
+				if (!set_array.is_same_typed(get_array)) {
+					value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
 				}
 			}
-			r->set_scene_unique_id(id);
 		}
 
-		if (!main) {
-			internal_index_cache[path] = res;
+		if (set_valid) {
+			p_res->set(name, value);
 		}
+	}
+
+	if (p_missing_resource) {
+		p_missing_resource->set_recording_properties(false);
+	}
 
-		int pc = f->get_32();
+	if (!missing_resource_properties.is_empty()) {
+		p_res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	}
 
-		//set properties
+#ifdef TOOLS_ENABLED
+	p_res->set_edited(false);
+#endif
+}
 
-		Dictionary missing_resource_properties;
+void ResourceLoaderBinary::_finish_load(const Ref<Resource> &p_main_resource) {
+	f.unref();
+	resource = p_main_resource;
+	resource->set_as_translation_remapped(translation_remapped);
+	error = OK;
+}
 
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
+// Decoding property values is most of the cost of loading large files and only depends on
+// the file itself, so it can be split across threads once every internal resource exists.
+bool ResourceLoaderBinary::_can_parse_threaded() const {
+	if (!use_sub_threads || !using_named_scene_ids || is_compressed || file_path.is_empty()) {
+		return false;
+	}
+	if (internal_resources.size() < 2 || f->get_length() < THREADED_PARSE_MIN_FILE_SIZE) {
+		return false;
+	}
+	return WorkerThreadPool::get_singleton()->get_thread_count() > 1;
+}
 
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
+void ResourceLoaderBinary::_parse_queued_properties(ThreadedParse *p_parse) {
+	while (true) {
+		uint32_t index = p_parse->next_resource.postincrement();
+		if (index >= p_parse->resources.size()) {
+			break;
+		}
+		ParsedResource &pr = p_parse->resources[index];
+		f->seek(pr.properties_offset);
+		pr.error = _parse_properties(pr.properties);
+	}
+}
 
-			Variant value;
+void ResourceLoaderBinary::_parse_properties_task(uint32_t p_parser, ThreadedParse *p_parse) {
+	// Each helper parser has its own file access, the calling thread keeps using this one.
+	p_parse->parsers[p_parser]->_parse_queued_properties(p_parse);
+}
 
-			error = parse_variant(value);
-			if (error) {
-				return error;
-			}
+Error ResourceLoaderBinary::_load_internal_resources_threaded() {
+	ThreadedParse parse;
 
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource != nullptr) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
+	// Create every resource first, in file order, so references between them can be resolved by any thread.
+	for (int i = 0; i < internal_resources.size(); i++) {
+		ParsedResource pr;
+		pr.index = i;
+		bool cached = false;
+		error = _create_internal_resource(i, pr.resource, pr.missing_resource, cached);
+		if (error) {
+			return error;
+		}
+		if (!cached) {
+			pr.properties_offset = f->get_position();
+			parse.resources.push_back(pr);
+		}
+	}
 
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
-			}
+	// Wait for dependencies here rather than from the parsing threads.
+	for (ExtResource &E : external_resources) {
+		if (E.load_token.is_valid()) {
+			Error err;
+			ResourceLoader::_load_complete(*E.load_token.ptr(), &err);
+		}
+	}
 
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
-				}
-			}
+	uint32_t parser_count = MIN((uint32_t)WorkerThreadPool::get_singleton()->get_thread_count(), parse.resources.size());
+	for (uint32_t i = 1; i < parser_count; i++) {
+		Ref<FileAccess> fa = FileAccess::open(file_path, FileAccess::READ);
+		if (fa.is_null()) {
+			break;
+		}
+		fa->set_big_endian(f->is_big_endian());
+		fa->real_is_double = f->real_is_double;
+
+		ResourceLoaderBinary *parser = memnew(ResourceLoaderBinary);
+		parser->f = fa;
+		parser->local_path = local_path;
+		parser->res_path = res_path;
+		parser->ver_format = ver_format;
+		parser->string_map = string_map;
+		parser->using_named_scene_ids = using_named_scene_ids;
+		parser->external_resources = external_resources;
+		parser->internal_resources = internal_resources;
+		parser->internal_index_cache = internal_index_cache;
+		parser->remaps = remaps;
+		parser->cache_mode_for_external = cache_mode_for_external;
+		parse.parsers.push_back(parser);
+	}
+
+	// This thread parses too, using its own file access.
+	WorkerThreadPool::GroupID group_id = -1;
+	if (!parse.parsers.is_empty()) {
+		group_id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ResourceLoaderBinary::_parse_properties_task, &parse, parse.parsers.size(), -1, true, SNAME("ResourceLoaderBinary"));
+	}
+	_parse_queued_properties(&parse);
+	if (group_id != -1) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_id);
+	}
+	for (ResourceLoaderBinary *parser : parse.parsers) {
+		memdelete(parser);
+	}
+
+	// Set properties in file order, so the result doesn't depend on scheduling.
+	for (const ParsedResource &pr : parse.resources) {
+		if (pr.error) {
+			error = pr.error;
+			return error;
+		}
 
-			if (set_valid) {
-				res->set(name, value);
-			}
+		_set_properties(pr.resource, pr.missing_resource, pr.properties);
+
+		if (progress) {
+			*progress = (pr.index + 1) / float(internal_resources.size());
 		}
 
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
+		resource_cache.push_back(pr.resource);
+	}
+
+	if (parse.resources.is_empty() || parse.resources[parse.resources.size() - 1].index != internal_resources.size() - 1) {
+		return ERR_FILE_EOF;
+	}
+
+	_finish_load(parse.resources[parse.resources.size() - 1].resource);
+	return OK;
+}
+
+Error ResourceLoaderBinary::load() {
+	if (error != OK) {
+		return error;
+	}
+
+	for (int i = 0; i < external_resources.size(); i++) {
+		String path = external_resources[i].path;
+
+		if (remaps.has(path)) {
+			path = remaps[path];
 		}
 
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+		if (!path.contains("://") && path.is_relative_path()) {
+			// path is relative to file being loaded, so convert to a resource path
+			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
 		}
 
-#ifdef TOOLS_ENABLED
-		res->set_edited(false);
-#endif
+		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
+		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
+		if (!external_resources[i].load_token.is_valid()) {
+			if (!ResourceLoader::get_abort_on_missing_resources()) {
+				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
+			} else {
+				error = ERR_FILE_MISSING_DEPENDENCIES;
+				ERR_FAIL_V_MSG(error, "Can't load dependency: " + path + ".");
+			}
+		}
+	}
+
+	if (_can_parse_threaded()) {
+		return _load_internal_resources_threaded();
+	}
+
+	for (int i = 0; i < internal_resources.size(); i++) {
+		bool main = i == (internal_resources.size() - 1);
+
+		Ref<Resource> res;
+		MissingResource *missing_resource = nullptr;
+		bool cached = false;
+		error = _create_internal_resource(i, res, missing_resource, cached);
+		if (error) {
+			return error;
+		}
+		if (cached) {
+			continue;
+		}
+
+		Vector<Pair<StringName, Variant>> properties;
+		error = _parse_properties(properties);
+		if (error) {
+			return error;
+		}
+		_set_properties(res, missing_resource, properties);
 
 		if (progress) {
 			*progress = (i + 1) / float(internal_resources.size());
@@ -871,10 +1035,7 @@ Error ResourceLoaderBinary::load() {
 		resource_cache.push_back(res);
 
 		if (main) {
-			f.unref();
-			resource = res;
-			resource->set_as_translation_remapped(translation_remapped);
-			error = OK;
+			_finish_load(res);
 			return OK;
 		}
 	}
@@ -910,8 +1071,13 @@ String ResourceLoaderBinary::get_unicode_string() {
 	if (len == 0) {
 		return String();
 	}
-	f->get_buffer((uint8_t *)&str_buf[0], len);
 	String s;
+	const uint8_t *view = f->get_buffer_view(len);
+	if (view) {
+		s.parse_utf8((const char *)view, len);
+		return s;
+	}
+	f->get_buffer((uint8_t *)&str_buf[0], len);
 	s.parse_utf8(&str_buf[0]);
 	return s;
 }
@@ -979,6 +1145,7 @@ void ResourceLoaderBinary::open(Ref<FileAccess> p_f, bool p_no_resources, bool p
 			ERR_FAIL_MSG("Failed to open binary resource file: " + local_path + ".");
 		}
 		f = fac;
+		is_compressed = true;
 
 	} else if (header[0] != 'R' || header[1] != 'S' || header[2] != 'R' || header[3] != 'C') {
 		// Not normal.
@@ -1222,6 +1389,7 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 	}
 	loader.use_sub_threads = p_use_sub_threads;
 	loader.progress = r_progress;
+	loader.file_path = p_path;
 	String path = !p_original_path.is_empty() ? p_original_path : p_path;
 	loader.local_path = ProjectSettings::get_singleton()->localize_path(path);
 	loader.res_path = loader.local_path;
@@ -2123,6 +2291,25 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 
 	ERR_FAIL_COND_V_MSG(err != OK, err, "Cannot create file '" + p_path + "'.");
 
+	return _save(f, p_path, p_resource, p_flags);
+}
+
+Error ResourceFormatSaverBinaryInstance::save_to_buffer(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags, Vector<uint8_t> &r_buffer, String &r_compression_magic) {
+	Ref<FileAccessMemory> f;
+	f.instantiate();
+	f->open_growable();
+
+	// Compressed files have no header of their own, the data is wrapped as save() would do with FileAccessCompressed.
+	r_compression_magic = (p_flags & ResourceSaver::FLAG_COMPRESS) ? "RSCC" : "";
+
+	Error err = _save(f, p_path, p_resource, p_flags);
+	if (err == OK) {
+		r_buffer = f->get_data();
+	}
+	return err;
+}
+
+Error ResourceFormatSaverBinaryInstance::_save(Ref<FileAccess> f, const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags) {
 	relative_paths = p_flags & ResourceSaver::FLAG_RELATIVE_PATHS;
 	skip_editor = p_flags & ResourceSaver::FLAG_OMIT_EDITOR_PROPERTIES;
 	bundle_resources = p_flags & ResourceSaver::FLAG_BUNDLE_RESOURCES;
@@ -2472,6 +2659,12 @@ Error ResourceFormatSaverBinary::save(const Ref<Resource> &p_resource, const Str
 	return saver.save(local_path, p_resource, p_flags);
 }
 
+Error ResourceFormatSaverBinary::save_to_buffer(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags, Vector<uint8_t> &r_buffer, String &r_compression_magic) {
+	String local_path = ProjectSettings::get_singleton()->localize_path(p_path);
+	ResourceFormatSaverBinaryInstance saver;
+	return saver.save_to_buffer(local_path, p_resource, p_flags, r_buffer, r_compression_magic);
+}
+
 Error ResourceFormatSaverBinary::set_uid(const String &p_path, ResourceUID::ID p_uid) {
 	String local_path = ProjectSettings::get_singleton()->localize_path(p_path);
 	ResourceFormatSaverBinaryInstance saver;
@@ -34,6 +34,11 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
+#include "core/templates/safe_refcount.h"
+
+class MissingResource;
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -91,6 +96,37 @@ class ResourceLoaderBinary {
 
 	Error parse_variant(Variant &r_v);
 
+	String file_path;
+	bool is_compressed = false;
+
+	// Below this size, threads cost more than they save.
+	static constexpr uint64_t THREADED_PARSE_MIN_FILE_SIZE = 1024 * 1024;
+
+	struct ParsedResource {
+		int index = 0;
+		Ref<Resource> resource;
+		MissingResource *missing_resource = nullptr;
+		uint64_t properties_offset = 0;
+		Vector<Pair<StringName, Variant>> properties;
+		Error error = OK;
+	};
+
+	struct ThreadedParse {
+		LocalVector<ParsedResource> resources;
+		LocalVector<ResourceLoaderBinary *> parsers;
+		SafeNumeric<uint32_t> next_resource;
+	};
+
+	Error _create_internal_resource(int p_index, Ref<Resource> &r_res, MissingResource *&r_missing_resource, bool &r_cached);
+	Error _parse_properties(Vector<Pair<StringName, Variant>> &r_properties);
+	void _set_properties(const Ref<Resource> &p_res, MissingResource *p_missing_resource, const Vector<Pair<StringName, Variant>> &p_properties);
+	void _finish_load(const Ref<Resource> &p_main_resource);
+
+	bool _can_parse_threaded() const;
+	void _parse_queued_properties(ThreadedParse *p_parse);
+	void _parse_properties_task(uint32_t p_parser, ThreadedParse *p_parse);
+	Error _load_internal_resources_threaded();
+
 	HashMap<String, Ref<Resource>> dependency_cache;
 
 public:
@@ -163,6 +199,8 @@ class ResourceFormatSaverBinaryInstance {
 	static void save_unicode_string(Ref<FileAccess> f, const String &p_string, bool p_bit_on_len = false);
 	int get_string_index(const String &p_string);
 
+	Error _save(Ref<FileAccess> f, const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags);
+
 public:
 	enum {
 		FORMAT_FLAG_NAMED_SCENE_IDS = 1,
@@ -174,6 +212,7 @@ public:
 		RESERVED_FIELDS = 11
 	};
 	Error save(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags = 0);
+	Error save_to_buffer(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags, Vector<uint8_t> &r_buffer, String &r_compression_magic);
 	Error set_uid(const String &p_path, ResourceUID::ID p_uid);
 	static void write_variant(Ref<FileAccess> f, const Variant &p_property, HashMap<Ref<Resource>, int> &resource_map, HashMap<Ref<Resource>, int> &external_resources, HashMap<StringName, int> &string_map, const PropertyInfo &p_hint = PropertyInfo());
 };
@@ -182,6 +221,7 @@ class ResourceFormatSaverBinary : public ResourceFormatSaver {
 public:
 	static ResourceFormatSaverBinary *singleton;
 	virtual Error save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags = 0) override;
+	virtual Error save_to_buffer(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags, Vector<uint8_t> &r_buffer, String &r_compression_magic) override;
 	virtual Error set_uid(const String &p_path, ResourceUID::ID p_uid) override;
 	virtual bool recognize(const Ref<Resource> &p_resource) const override;
 	virtual void get_recognized_extensions(const Ref<Resource> &p_resource, List<String> *p_extensions) const override;
@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/io/file_access.h"
 #include "core/io/resource_importer.h"
+#include "core/io/resource_saver.h"
 #include "core/object/script_language.h"
 #include "core/os/condition_variable.h"
 #include "core/os/os.h"
@@ -215,7 +216,14 @@ void ResourceLoader::LoadToken::clear() {
 	if (!local_path.is_empty()) { // Empty is used for the special case where the load task is not registered.
 		DEV_ASSERT(thread_load_tasks.has(local_path));
 		ThreadLoadTask &load_task = thread_load_tasks[local_path];
-		if (!load_task.awaited) {
+		if (load_task.queued) {
+			// Never started, so there's nothing to await.
+			int64_t idx = queued_user_loads.find(local_path);
+			if (idx != -1) {
+				queued_user_loads.remove_at(idx);
+			}
+			load_task.queued = false;
+		} else if (!load_task.awaited) {
 			task_to_await = load_task.task_id;
 			load_task.awaited = true;
 		}
@@ -242,6 +250,8 @@ ResourceLoader::LoadToken::~LoadToken() {
 }
 
 Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_original_path, const String &p_type_hint, ResourceFormatLoader::CacheMode p_cache_mode, Error *r_error, bool p_use_sub_threads, float *r_progress) {
+	MemoryTagScope memory_tag(Memory::TAG_RESOURCES);
+
 	const String &original_path = p_original_path.is_empty() ? p_path : p_original_path;
 	load_nesting++;
 	if (load_paths_stack->size()) {
@@ -257,6 +267,9 @@ Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_origin
 	}
 	load_paths_stack->push_back(original_path);
 
+	// Don't read a file that a threaded save is still writing.
+	ResourceSaver::wait_for_threaded_save(p_path);
+
 	// Try all loaders and pick the first match for the type hint
 	bool found = false;
 	Ref<Resource> res;
@@ -296,6 +309,9 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 	caller_task_id = load_task.task_id;
 	if (cleaning_tasks) {
 		load_task.status = THREAD_LOAD_FAILED;
+		if (load_task.user_request) {
+			running_user_loads--;
+		}
 		thread_load_mutex.unlock();
 		return;
 	}
@@ -391,6 +407,17 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 		}
 	}
 
+	if (load_task.user_request) {
+		running_user_loads--;
+		_dispatch_queued_loads();
+	}
+	_notify_load_progress();
+
+	if (cancelled_load_tokens.find(load_task.load_token) != -1 && MessageQueue::get_main_singleton()) {
+		// Releasing the token awaits this task, so it can't be done from here.
+		MessageQueue::get_main_singleton()->push_callable(callable_mp_static(&ResourceLoader::_release_finished_cancelled_loads));
+	}
+
 	thread_load_mutex.unlock();
 
 	if (load_nesting == 0) {
@@ -412,8 +439,9 @@ static String _validate_local_path(const String &p_path) {
 	}
 }
 
-Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, ResourceFormatLoader::CacheMode p_cache_mode) {
+Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, ResourceFormatLoader::CacheMode p_cache_mode, int p_priority) {
 	thread_load_mutex.lock();
+	_release_cancelled_load_tokens();
 	if (user_load_tokens.has(p_path)) {
 		print_verbose("load_threaded_request(): Another threaded load for resource path '" + p_path + "' has been initiated. Not an error.");
 		user_load_tokens[p_path]->reference(); // Additional request.
@@ -423,7 +451,7 @@ Error ResourceLoader::load_threaded_request(const String &p_path, const String &
 	user_load_tokens[p_path] = nullptr;
 	thread_load_mutex.unlock();
 
-	Ref<ResourceLoader::LoadToken> token = _load_start(p_path, p_type_hint, p_use_sub_threads ? LOAD_THREAD_DISTRIBUTE : LOAD_THREAD_SPAWN_SINGLE, p_cache_mode);
+	Ref<ResourceLoader::LoadToken> token = _load_start(p_path, p_type_hint, p_use_sub_threads ? LOAD_THREAD_DISTRIBUTE : LOAD_THREAD_SPAWN_SINGLE, p_cache_mode, true, p_priority);
 	if (token.is_valid()) {
 		thread_load_mutex.lock();
 		token->user_path = p_path;
@@ -454,7 +482,7 @@ Ref<Resource> ResourceLoader::load(const String &p_path, const String &p_type_hi
 	return res;
 }
 
-Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode) {
+Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode, bool p_user_request, int p_priority) {
 	String local_path = _validate_local_path(p_path);
 
 	Ref<LoadToken> load_token;
@@ -519,8 +547,15 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 
 		if (run_on_current_thread) {
 			load_task_ptr->thread_id = Thread::get_caller_id();
+		} else if (p_user_request) {
+			// User requests wait for a free slot, so higher-priority ones can overtake them.
+			load_task_ptr->user_request = true;
+			load_task_ptr->priority = p_priority;
+			load_task_ptr->queued = true;
+			queued_user_loads.push_back(local_path);
+			_dispatch_queued_loads();
 		} else {
-			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_thread_load_function, load_task_ptr);
+			_start_load_task(*load_task_ptr);
 		}
 	}
 
@@ -534,6 +569,88 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 	return load_token;
 }
 
+// Must be called with thread_load_mutex held.
+void ResourceLoader::_start_load_task(ThreadLoadTask &p_load_task) {
+	if (p_load_task.queued) {
+		int64_t idx = queued_user_loads.find(p_load_task.local_path);
+		if (idx != -1) {
+			queued_user_loads.remove_at(idx);
+		}
+		p_load_task.queued = false;
+	}
+	if (p_load_task.user_request) {
+		running_user_loads++;
+	}
+	p_load_task.task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_thread_load_function, &p_load_task);
+}
+
+// Must be called with thread_load_mutex held.
+void ResourceLoader::_dispatch_queued_loads() {
+	while (queued_user_loads.size() && (max_concurrent_user_loads <= 0 || running_user_loads < max_concurrent_user_loads)) {
+		// Highest priority first; requests with the same priority are started in order.
+		ThreadLoadTask *next = nullptr;
+		for (const String &E : queued_user_loads) {
+			ThreadLoadTask &load_task = thread_load_tasks[E];
+			if (!next || load_task.priority > next->priority) {
+				next = &load_task;
+			}
+		}
+		_start_load_task(*next);
+	}
+}
+
+// Must be called with thread_load_mutex held.
+void ResourceLoader::_release_cancelled_load_tokens() {
+	for (uint32_t i = 0; i < cancelled_load_tokens.size(); i++) {
+		LoadToken *load_token = cancelled_load_tokens[i];
+		HashMap<String, ThreadLoadTask>::Iterator E = thread_load_tasks.find(load_token->local_path);
+		if (E && E->value.status == THREAD_LOAD_IN_PROGRESS) {
+			continue;
+		}
+		cancelled_load_tokens.remove_at_unordered(i);
+		i--;
+		if (load_token->unreference()) {
+			memdelete(load_token);
+		}
+	}
+}
+
+void ResourceLoader::_release_finished_cancelled_loads() {
+	MutexLock thread_load_lock(thread_load_mutex);
+	_release_cancelled_load_tokens();
+}
+
+void ResourceLoader::_call_progress_notify(const String &p_path, int p_status, float p_progress) {
+	if (progress_notify) {
+		progress_notify(p_path, (ThreadLoadStatus)p_status, p_progress);
+	}
+}
+
+// Must be called with thread_load_mutex held.
+void ResourceLoader::_notify_load_progress() {
+	if (!progress_notify || !MessageQueue::get_main_singleton()) {
+		return;
+	}
+
+	for (const KeyValue<String, LoadToken *> &E : user_load_tokens) {
+		if (!E.value || E.value->local_path.is_empty()) {
+			continue;
+		}
+		HashMap<String, ThreadLoadTask>::Iterator T = thread_load_tasks.find(E.value->local_path);
+		if (!T) {
+			continue;
+		}
+		ThreadLoadTask &load_task = T->value;
+		float progress = _dependency_get_progress(E.value->local_path);
+		if (load_task.status == load_task.notified_status && progress <= load_task.notified_progress) {
+			continue;
+		}
+		load_task.notified_status = load_task.status;
+		load_task.notified_progress = progress;
+		MessageQueue::get_main_singleton()->push_callable(callable_mp_static(&ResourceLoader::_call_progress_notify), E.key, (int)load_task.status, progress);
+	}
+}
+
 float ResourceLoader::_dependency_get_progress(const String &p_path) {
 	if (thread_load_tasks.has(p_path)) {
 		ThreadLoadTask &load_task = thread_load_tasks[p_path];
@@ -558,6 +675,7 @@ float ResourceLoader::_dependency_get_progress(const String &p_path) {
 
 ResourceLoader::ThreadLoadStatus ResourceLoader::load_threaded_get_status(const String &p_path, float *r_progress) {
 	MutexLock thread_load_lock(thread_load_mutex);
+	_release_cancelled_load_tokens();
 
 	if (!user_load_tokens.has(p_path)) {
 		print_verbose("load_threaded_get_status(): No threaded load for resource path '" + p_path + "' has been initiated or its result has already been collected.");
@@ -619,6 +737,72 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 	return res;
 }
 
+Error ResourceLoader::load_threaded_set_priority(const String &p_path, int p_priority) {
+	MutexLock thread_load_lock(thread_load_mutex);
+
+	if (!user_load_tokens.has(p_path)) {
+		print_verbose("load_threaded_set_priority(): No threaded load for resource path '" + p_path + "' has been initiated or its result has already been collected.");
+		return ERR_INVALID_PARAMETER;
+	}
+
+	LoadToken *load_token = user_load_tokens[p_path];
+	if (!load_token) {
+		return ERR_BUSY;
+	}
+
+	// Only affects loads still waiting for a free slot.
+	HashMap<String, ThreadLoadTask>::Iterator E = thread_load_tasks.find(load_token->local_path);
+	if (E) {
+		E->value.priority = p_priority;
+	}
+	return OK;
+}
+
+Error ResourceLoader::load_threaded_cancel(const String &p_path) {
+	MutexLock thread_load_lock(thread_load_mutex);
+	_release_cancelled_load_tokens();
+
+	if (!user_load_tokens.has(p_path)) {
+		print_verbose("load_threaded_cancel(): No threaded load for resource path '" + p_path + "' has been initiated or its result has already been collected.");
+		return ERR_INVALID_PARAMETER;
+	}
+
+	LoadToken *load_token = user_load_tokens[p_path];
+	if (!load_token) {
+		return ERR_BUSY;
+	}
+
+	if (load_token->get_reference_count() == 1 && !load_token->local_path.is_empty()) {
+		ThreadLoadTask &load_task = thread_load_tasks[load_token->local_path];
+		if (load_task.status == THREAD_LOAD_IN_PROGRESS && !load_task.queued) {
+			// Loaders can't be interrupted and releasing the token would block until the load is done,
+			// so let it finish in the background and drop its result then.
+			user_load_tokens.erase(p_path);
+			load_token->user_path.clear();
+			cancelled_load_tokens.push_back(load_token);
+			return OK;
+		}
+	}
+
+	// If it was still queued, this removes it before it ever starts.
+	if (load_token->unreference()) {
+		memdelete(load_token);
+	}
+	return OK;
+}
+
+void ResourceLoader::set_max_concurrent_loads(int p_max_loads) {
+	MutexLock thread_load_lock(thread_load_mutex);
+
+	if (p_max_loads <= 0) {
+		// As many as the worker pool can run at once anyway, so the queue only decides the order.
+		// Without a pool there is nothing to match, so don't limit them.
+		p_max_loads = WorkerThreadPool::get_singleton() ? WorkerThreadPool::get_singleton()->get_low_priority_thread_count() : 0;
+	}
+	max_concurrent_user_loads = p_max_loads;
+	_dispatch_queued_loads();
+}
+
 Ref<Resource> ResourceLoader::_load_complete(LoadToken &p_load_token, Error *r_error) {
 	MutexLock thread_load_lock(thread_load_mutex);
 	return _load_complete_inner(p_load_token, r_error, thread_load_lock);
@@ -644,6 +828,11 @@ Ref<Resource> ResourceLoader::_load_complete_inner(LoadToken &p_load_token, Erro
 		ThreadLoadTask &load_task = thread_load_tasks[p_load_token.local_path];
 
 		if (load_task.status == THREAD_LOAD_IN_PROGRESS) {
+			if (load_task.queued) {
+				// Someone needs it right now, so it can't keep waiting for a free slot.
+				_start_load_task(load_task);
+			}
+
 			DEV_ASSERT((load_task.task_id == 0) != (load_task.thread_id == 0));
 
 			if ((load_task.task_id != 0 && load_task.task_id == caller_task_id) ||
@@ -1061,6 +1250,14 @@ void ResourceLoader::clear_thread_load_tasks() {
 	thread_load_mutex.lock();
 	cleaning_tasks = true;
 
+	// Loads that never got a slot won't start at all.
+	for (const String &E : queued_user_loads) {
+		ThreadLoadTask &load_task = thread_load_tasks[E];
+		load_task.queued = false;
+		load_task.status = THREAD_LOAD_FAILED;
+	}
+	queued_user_loads.clear();
+
 	while (true) {
 		bool none_running = true;
 		if (thread_load_tasks.size()) {
@@ -1083,6 +1280,14 @@ void ResourceLoader::clear_thread_load_tasks() {
 		thread_load_mutex.lock();
 	}
 
+	while (cancelled_load_tokens.size()) {
+		LoadToken *load_token = cancelled_load_tokens[cancelled_load_tokens.size() - 1];
+		cancelled_load_tokens.resize(cancelled_load_tokens.size() - 1);
+		if (load_token->unreference()) {
+			memdelete(load_token);
+		}
+	}
+
 	while (user_load_tokens.begin()) {
 		// User load tokens remove themselves from the map on destruction.
 		memdelete(user_load_tokens.begin()->value);
@@ -1090,6 +1295,7 @@ void ResourceLoader::clear_thread_load_tasks() {
 	user_load_tokens.clear();
 
 	thread_load_tasks.clear();
+	running_user_loads = 0;
 
 	cleaning_tasks = false;
 	thread_load_mutex.unlock();
@@ -1216,6 +1422,12 @@ bool ResourceLoader::cleaning_tasks = false;
 
 HashMap<String, ResourceLoader::LoadToken *> ResourceLoader::user_load_tokens;
 
+int ResourceLoader::max_concurrent_user_loads = 0;
+int ResourceLoader::running_user_loads = 0;
+LocalVector<String> ResourceLoader::queued_user_loads;
+LocalVector<ResourceLoader::LoadToken *> ResourceLoader::cancelled_load_tokens;
+ResourceLoader::LoadProgressNotify ResourceLoader::progress_notify = nullptr;
+
 SelfList<Resource>::List ResourceLoader::remapped_list;
 HashMap<String, Vector<String>> ResourceLoader::translation_remaps;
 HashMap<String, String> ResourceLoader::path_remaps;
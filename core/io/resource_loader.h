@@ -118,6 +118,8 @@ public:
 		LOAD_THREAD_DISTRIBUTE,
 	};
 
+	typedef void (*LoadProgressNotify)(const String &p_path, ThreadLoadStatus p_status, float p_progress);
+
 	struct LoadToken : public RefCounted {
 		String local_path;
 		String user_path;
@@ -130,7 +132,7 @@ public:
 
 	static const int BINARY_MUTEX_TAG = 1;
 
-	static Ref<LoadToken> _load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode);
+	static Ref<LoadToken> _load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode, bool p_user_request = false, int p_priority = 0);
 	static Ref<Resource> _load_complete(LoadToken &p_load_token, Error *r_error);
 
 private:
@@ -180,10 +182,21 @@ private:
 		Ref<Resource> resource;
 		bool xl_remapped = false;
 		bool use_sub_threads = false;
+		bool user_request = false; // Started by load_threaded_request(), so it counts towards the concurrency limit.
+		bool queued = false; // Waiting in queued_user_loads for a free slot; neither task_id nor thread_id are set yet.
+		int priority = 0;
+		ThreadLoadStatus notified_status = THREAD_LOAD_INVALID_RESOURCE;
+		float notified_progress = -1.0f;
 		HashSet<String> sub_tasks;
 	};
 
 	static void _thread_load_function(void *p_userdata);
+	static void _start_load_task(ThreadLoadTask &p_load_task);
+	static void _dispatch_queued_loads();
+	static void _release_cancelled_load_tokens();
+	static void _release_finished_cancelled_loads();
+	static void _notify_load_progress();
+	static void _call_progress_notify(const String &p_path, int p_status, float p_progress);
 
 	static thread_local int load_nesting;
 	static thread_local WorkerThreadPool::TaskID caller_task_id;
@@ -194,12 +207,27 @@ private:
 
 	static HashMap<String, LoadToken *> user_load_tokens;
 
+	static int max_concurrent_user_loads; // Zero means unlimited.
+	static int running_user_loads;
+	static LocalVector<String> queued_user_loads;
+	static LocalVector<LoadToken *> cancelled_load_tokens; // Cancelled while running; released once the load finishes.
+	static LoadProgressNotify progress_notify;
+
 	static float _dependency_get_progress(const String &p_path);
 
 public:
-	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE);
+	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE, int p_priority = 0);
 	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = nullptr);
 	static Ref<Resource> load_threaded_get(const String &p_path, Error *r_error = nullptr);
+	static Error load_threaded_set_priority(const String &p_path, int p_priority);
+	static Error load_threaded_cancel(const String &p_path);
+
+	// Zero or less matches the low-priority thread count of the WorkerThreadPool.
+	static void set_max_concurrent_loads(int p_max_loads);
+	static int get_max_concurrent_loads() { return max_concurrent_user_loads; }
+
+	// The callback is always invoked on the main thread.
+	static void set_load_progress_notify_func(LoadProgressNotify p_notify) { progress_notify = p_notify; }
 
 	static bool is_within_load() { return load_nesting > 0; };
 
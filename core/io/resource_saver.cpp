@@ -30,8 +30,11 @@
 
 #include "resource_saver.h"
 #include "core/config/project_settings.h"
+#include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/resource_loader.h"
+#include "core/object/message_queue.h"
 #include "core/object/script_language.h"
 
 Ref<ResourceFormatSaver> ResourceSaver::saver[MAX_SAVERS];
@@ -40,6 +43,10 @@ int ResourceSaver::saver_count = 0;
 bool ResourceSaver::timestamp_on_save = false;
 ResourceSavedCallback ResourceSaver::save_callback = nullptr;
 ResourceSaverGetResourceIDForPath ResourceSaver::save_get_id_for_path = nullptr;
+Mutex ResourceSaver::threaded_save_mutex;
+HashMap<String, ResourceSaver::PendingSave> ResourceSaver::pending_saves;
+uint64_t ResourceSaver::last_save_serial = 0;
+ResourceSavedThreadedNotify ResourceSaver::threaded_save_notify = nullptr;
 
 Error ResourceFormatSaver::save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags) {
 	Error err = ERR_METHOD_NOT_FOUND;
@@ -47,6 +54,10 @@ Error ResourceFormatSaver::save(const Ref<Resource> &p_resource, const String &p
 	return err;
 }
 
+Error ResourceFormatSaver::save_to_buffer(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags, Vector<uint8_t> &r_buffer, String &r_compression_magic) {
+	return ERR_UNAVAILABLE;
+}
+
 Error ResourceFormatSaver::set_uid(const String &p_path, ResourceUID::ID p_uid) {
 	Error err = ERR_FILE_UNRECOGNIZED;
 	GDVIRTUAL_CALL(_set_uid, p_path, p_uid, err);
@@ -105,6 +116,9 @@ Error ResourceSaver::save(const Ref<Resource> &p_resource, const String &p_path,
 	}
 	ERR_FAIL_COND_V_MSG(path.is_empty(), ERR_INVALID_PARAMETER, "Can't save resource to empty path. Provide non-empty path or a Resource with non-empty resource_path.");
 
+	// Otherwise an older threaded save could be renamed over the file written here.
+	wait_for_threaded_save(path);
+
 	String extension = path.get_extension();
 	Error err = ERR_FILE_UNRECOGNIZED;
 
@@ -153,6 +167,204 @@ Error ResourceSaver::save(const Ref<Resource> &p_resource, const String &p_path,
 	return err;
 }
 
+Error ResourceSaver::save_threaded(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags) {
+	ERR_FAIL_COND_V_MSG(p_resource.is_null(), ERR_INVALID_PARAMETER, "Can't save empty resource to path '" + p_path + "'.");
+	String path = p_path;
+	if (path.is_empty()) {
+		path = p_resource->get_path();
+	}
+	ERR_FAIL_COND_V_MSG(path.is_empty(), ERR_INVALID_PARAMETER, "Can't save resource to empty path. Provide non-empty path or a Resource with non-empty resource_path.");
+
+	String local_path = ProjectSettings::get_singleton()->localize_path(path);
+
+	// A previous save to the same file must be done before this one can be written over it.
+	_wait_pending_save(local_path);
+
+	Error err = ERR_FILE_UNRECOGNIZED;
+
+	for (int i = 0; i < saver_count; i++) {
+		if (!saver[i]->recognize(p_resource)) {
+			continue;
+		}
+
+		if (!saver[i]->recognize_path(p_resource, path)) {
+			continue;
+		}
+
+		String old_path = p_resource->get_path();
+
+		if (p_flags & FLAG_CHANGE_PATH) {
+			p_resource->set_path(local_path);
+		}
+
+		// The resource is serialized here, on the calling thread, so it can keep being modified
+		// as soon as this returns. Only compressing and writing the file happen in the background.
+		ThreadedSave *ts = memnew(ThreadedSave);
+		err = saver[i]->save_to_buffer(p_resource, path, p_flags, ts->data, ts->compression_magic);
+
+		if (p_flags & FLAG_CHANGE_PATH) {
+			p_resource->set_path(old_path);
+		}
+
+		if (err == ERR_UNAVAILABLE || !WorkerThreadPool::get_singleton()) {
+			memdelete(ts);
+
+			// This saver can only write files itself, so save synchronously but still report completion.
+			err = save(p_resource, path, p_flags);
+			if (MessageQueue::get_main_singleton()) {
+				MessageQueue::get_main_singleton()->push_callable(callable_mp_static(&ResourceSaver::_save_threaded_done), Ref<Resource>(), local_path, path, (int)err, (uint64_t)0);
+			}
+			return err;
+		}
+
+		if (err != OK) {
+			memdelete(ts);
+			continue;
+		}
+
+#ifdef TOOLS_ENABLED
+		((Resource *)p_resource.ptr())->set_edited(false);
+#endif
+
+		ts->resource = p_resource;
+		ts->path = local_path;
+		ts->save_path = path;
+
+		MutexLock lock(threaded_save_mutex);
+		ts->serial = ++last_save_serial;
+		PendingSave pending;
+		pending.serial = ts->serial;
+		pending.task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceSaver::_save_threaded_task, ts, false, SNAME("ResourceSaver"));
+		pending_saves[local_path] = pending;
+
+		return OK;
+	}
+
+	return err;
+}
+
+void ResourceSaver::_save_threaded_task(void *p_userdata) {
+	ThreadedSave *ts = (ThreadedSave *)p_userdata;
+
+	Error err = OK;
+	Vector<uint8_t> compressed;
+	const Vector<uint8_t> *data = &ts->data;
+	if (!ts->compression_magic.is_empty()) {
+		compressed = FileAccessCompressed::compress_buffer(ts->data.ptr(), ts->data.size(), ts->compression_magic);
+		data = &compressed;
+		if (compressed.is_empty()) {
+			err = ERR_CANT_CREATE;
+		}
+	}
+
+	// The file is written next to the target and renamed over it, so a failed
+	// or interrupted save never leaves a truncated file behind.
+	String temp_path = ts->path + ".tmp";
+	if (err == OK) {
+		Ref<FileAccess> f = FileAccess::open(temp_path, FileAccess::WRITE, &err);
+		if (f.is_valid()) {
+			f->store_buffer(data->ptr(), data->size());
+			if (f->get_error() != OK && f->get_error() != ERR_FILE_EOF) {
+				err = ERR_CANT_CREATE;
+			}
+			f->close();
+		}
+	}
+
+	Ref<DirAccess> da = DirAccess::create_for_path(temp_path);
+	if (err == OK) {
+		err = da->rename(temp_path, ts->path);
+	}
+	if (err != OK) {
+		if (da->file_exists(temp_path)) {
+			da->remove(temp_path);
+		}
+		ERR_PRINT(vformat("Failed to save resource to '%s' in the background (error %d).", ts->path, err));
+	}
+	if (MessageQueue::get_main_singleton()) {
+		MessageQueue::get_main_singleton()->push_callable(callable_mp_static(&ResourceSaver::_save_threaded_done), ts->resource, ts->path, ts->save_path, (int)err, ts->serial);
+	}
+
+	memdelete(ts);
+}
+
+void ResourceSaver::_save_threaded_done(const Ref<Resource> &p_resource, const String &p_path, const String &p_save_path, int p_error, uint64_t p_serial) {
+	WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+	{
+		MutexLock lock(threaded_save_mutex);
+		PendingSave *pending = pending_saves.getptr(p_path);
+		if (pending && pending->serial == p_serial) {
+			task_id = pending->task_id;
+			pending_saves.erase(p_path);
+		}
+	}
+	if (task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+	}
+
+	if (p_error == OK && p_resource.is_valid()) {
+#ifdef TOOLS_ENABLED
+		if (timestamp_on_save) {
+			uint64_t mt = FileAccess::get_modified_time(p_path);
+
+			((Resource *)p_resource.ptr())->set_last_modified_time(mt);
+		}
+#endif
+
+		if (save_callback && p_save_path.begins_with("res://")) {
+			save_callback(p_resource, p_save_path);
+		}
+	}
+
+	if (threaded_save_notify) {
+		threaded_save_notify(p_path, (Error)p_error);
+	}
+}
+
+void ResourceSaver::_wait_pending_save(const String &p_path) {
+	WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+	{
+		MutexLock lock(threaded_save_mutex);
+		PendingSave *pending = pending_saves.getptr(p_path);
+		if (pending) {
+			task_id = pending->task_id;
+			pending_saves.erase(p_path);
+		}
+	}
+	if (task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+	}
+}
+
+bool ResourceSaver::is_threaded_save_pending(const String &p_path) {
+	MutexLock lock(threaded_save_mutex);
+	return pending_saves.has(ProjectSettings::get_singleton()->localize_path(p_path));
+}
+
+void ResourceSaver::wait_for_threaded_save(const String &p_path) {
+	{
+		MutexLock lock(threaded_save_mutex);
+		if (pending_saves.is_empty()) {
+			return;
+		}
+	}
+	_wait_pending_save(ProjectSettings::get_singleton()->localize_path(p_path));
+}
+
+void ResourceSaver::wait_for_threaded_saves() {
+	LocalVector<WorkerThreadPool::TaskID> task_ids;
+	{
+		MutexLock lock(threaded_save_mutex);
+		for (const KeyValue<String, PendingSave> &E : pending_saves) {
+			task_ids.push_back(E.value.task_id);
+		}
+		pending_saves.clear();
+	}
+	for (WorkerThreadPool::TaskID task_id : task_ids) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+	}
+}
+
 Error ResourceSaver::set_uid(const String &p_path, ResourceUID::ID p_uid) {
 	String path = p_path;
 
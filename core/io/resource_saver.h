@@ -33,6 +33,8 @@
 
 #include "core/io/resource.h"
 #include "core/object/gdvirtual.gen.inc"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
 
 class ResourceFormatSaver : public RefCounted {
 	GDCLASS(ResourceFormatSaver, RefCounted);
@@ -48,6 +50,9 @@ protected:
 
 public:
 	virtual Error save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags = 0);
+	// Serializes the resource into r_buffer as save() would write it to p_path, so the file can be written later from another thread.
+	// When FLAG_COMPRESS is handled by wrapping the file in FileAccessCompressed, r_buffer is left uncompressed and r_compression_magic is set to the magic to compress it with.
+	virtual Error save_to_buffer(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags, Vector<uint8_t> &r_buffer, String &r_compression_magic);
 	virtual Error set_uid(const String &p_path, ResourceUID::ID p_uid);
 	virtual bool recognize(const Ref<Resource> &p_resource) const;
 	virtual void get_recognized_extensions(const Ref<Resource> &p_resource, List<String> *p_extensions) const;
@@ -58,6 +63,7 @@ public:
 
 typedef void (*ResourceSavedCallback)(Ref<Resource> p_resource, const String &p_path);
 typedef ResourceUID::ID (*ResourceSaverGetResourceIDForPath)(const String &p_path, bool p_generate);
+typedef void (*ResourceSavedThreadedNotify)(const String &p_path, Error p_error);
 
 class ResourceSaver {
 	enum {
@@ -72,6 +78,29 @@ class ResourceSaver {
 
 	static Ref<ResourceFormatSaver> _find_custom_resource_format_saver(const String &path);
 
+	struct ThreadedSave {
+		Ref<Resource> resource;
+		String path;
+		String save_path; // As passed to save_threaded(), given to the save callback like save() does.
+		Vector<uint8_t> data;
+		String compression_magic;
+		uint64_t serial = 0;
+	};
+
+	struct PendingSave {
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+		uint64_t serial = 0;
+	};
+
+	static Mutex threaded_save_mutex;
+	static HashMap<String, PendingSave> pending_saves;
+	static uint64_t last_save_serial;
+	static ResourceSavedThreadedNotify threaded_save_notify;
+
+	static void _save_threaded_task(void *p_userdata);
+	static void _save_threaded_done(const Ref<Resource> &p_resource, const String &p_path, const String &p_save_path, int p_error, uint64_t p_serial);
+	static void _wait_pending_save(const String &p_path);
+
 public:
 	enum SaverFlags {
 		FLAG_NONE = 0,
@@ -85,6 +114,11 @@ public:
 	};
 
 	static Error save(const Ref<Resource> &p_resource, const String &p_path = "", uint32_t p_flags = (uint32_t)FLAG_NONE);
+	static Error save_threaded(const Ref<Resource> &p_resource, const String &p_path = "", uint32_t p_flags = (uint32_t)FLAG_NONE);
+	static bool is_threaded_save_pending(const String &p_path);
+	static void wait_for_threaded_save(const String &p_path);
+	static void wait_for_threaded_saves();
+	static void set_threaded_save_notify_func(ResourceSavedThreadedNotify p_notify) { threaded_save_notify = p_notify; }
 	static void get_recognized_extensions(const Ref<Resource> &p_resource, List<String> *p_extensions);
 	static void add_resource_format_saver(Ref<ResourceFormatSaver> p_format_saver, bool p_at_front = false);
 	static void remove_resource_format_saver(Ref<ResourceFormatSaver> p_format_saver);
@@ -30,6 +30,8 @@
 
 #include "aabb.h"
 
+#include "core/math/simd.h"
+
 #include "core/string/ustring.h"
 #include "core/variant/variant.h"
 
@@ -276,6 +278,52 @@ bool AABB::intersects_plane(const Plane &p_plane) const {
 	return under && over;
 }
 
+void AABB::intersects_planes_batch(const real_t *p_bounds, uint32_t p_count, const Plane *p_planes, uint32_t p_plane_count, bool *r_results) {
+	// Each plane is tested against the corner of the box that lies furthest behind it.
+	uint32_t i = 0;
+#ifdef SIMD_FLOAT4_ENABLED
+	const SimdFloat4 zero = SimdFloat4::splat(0);
+	for (; i + 4 <= p_count; i += 4) {
+		// Four boxes at a time, one per lane.
+		const real_t *bounds = p_bounds + i * 6;
+		SimdFloat4 lanes[6];
+		for (int j = 0; j < 6; j++) {
+			lanes[j] = SimdFloat4::set(bounds[j], bounds[6 + j], bounds[12 + j], bounds[18 + j]);
+		}
+
+		uint32_t outside = 0;
+		for (uint32_t j = 0; j < p_plane_count && outside != 0xF; j++) {
+			const Plane &plane = p_planes[j];
+			SimdFloat4 distance = SimdFloat4::splat(plane.normal.x) * lanes[plane.normal.x > 0 ? 0 : 3];
+			distance = SimdFloat4::mul_add(SimdFloat4::splat(plane.normal.y), lanes[plane.normal.y > 0 ? 1 : 4], distance);
+			distance = SimdFloat4::mul_add(SimdFloat4::splat(plane.normal.z), lanes[plane.normal.z > 0 ? 2 : 5], distance);
+			distance = distance - SimdFloat4::splat(plane.d);
+			outside |= distance.greater_equal_mask(zero);
+		}
+
+		for (int j = 0; j < 4; j++) {
+			r_results[i + j] = !(outside & (1 << j));
+		}
+	}
+#endif
+	for (; i < p_count; i++) {
+		const real_t *bounds = p_bounds + i * 6;
+		bool inside = true;
+		for (uint32_t j = 0; j < p_plane_count; j++) {
+			const Plane &plane = p_planes[j];
+			const Vector3 point(
+					bounds[plane.normal.x > 0 ? 0 : 3],
+					bounds[plane.normal.y > 0 ? 1 : 4],
+					bounds[plane.normal.z > 0 ? 2 : 5]);
+			if (plane.distance_to(point) >= 0) {
+				inside = false;
+				break;
+			}
+		}
+		r_results[i] = inside;
+	}
+}
+
 Vector3 AABB::get_longest_axis() const {
 	Vector3 axis(1, 0, 0);
 	real_t max_size = size.x;
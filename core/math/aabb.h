@@ -83,6 +83,10 @@ struct _NO_DISCARD_ AABB {
 	_FORCE_INLINE_ bool intersects_convex_shape(const Plane *p_planes, int p_plane_count, const Vector3 *p_points, int p_point_count) const;
 	_FORCE_INLINE_ bool inside_convex_shape(const Plane *p_planes, int p_plane_count) const;
 	bool intersects_plane(const Plane &p_plane) const;
+	// Tests p_count boxes, each given as 6 consecutive values (begin x, y, z, then end x, y, z), against
+	// a convex set of outward facing planes. r_results[i] is false if box i is entirely in front of one
+	// of the planes. Like most culling tests this is conservative, some boxes outside the set may pass.
+	static void intersects_planes_batch(const real_t *p_bounds, uint32_t p_count, const Plane *p_planes, uint32_t p_plane_count, bool *r_results);
 
 	_FORCE_INLINE_ bool has_point(const Vector3 &p_point) const;
 	_FORCE_INLINE_ Vector3 get_support(const Vector3 &p_normal) const;
@@ -0,0 +1,150 @@
+/**************************************************************************/
+/*  simd.h                                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SIMD_H
+#define SIMD_H
+
+#include "core/math/math_defs.h"
+#include "core/typedefs.h"
+
+// Minimal 4-wide float vector used by the batch functions of the math types.
+// Only the baseline instruction set of each architecture is used (SSE2 on x86_64,
+// NEON on arm64), since the engine isn't built with runtime CPU dispatch.
+// With double precision, or on other architectures, SIMD_FLOAT4_ENABLED isn't
+// defined and the batch functions use their scalar code path.
+
+#ifndef REAL_T_IS_DOUBLE
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD_FLOAT4_ENABLED
+#define SIMD_FLOAT4_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define SIMD_FLOAT4_ENABLED
+#define SIMD_FLOAT4_NEON
+#include <arm_neon.h>
+#endif
+#endif // REAL_T_IS_DOUBLE
+
+#ifdef SIMD_FLOAT4_ENABLED
+
+struct SimdFloat4 {
+#ifdef SIMD_FLOAT4_SSE2
+	__m128 v;
+#else
+	float32x4_t v;
+#endif
+
+	static _FORCE_INLINE_ SimdFloat4 load(const float *p_ptr) {
+#ifdef SIMD_FLOAT4_SSE2
+		return { _mm_loadu_ps(p_ptr) };
+#else
+		return { vld1q_f32(p_ptr) };
+#endif
+	}
+
+	static _FORCE_INLINE_ SimdFloat4 set(float p_x, float p_y, float p_z, float p_w) {
+#ifdef SIMD_FLOAT4_SSE2
+		return { _mm_setr_ps(p_x, p_y, p_z, p_w) };
+#else
+		const float values[4] = { p_x, p_y, p_z, p_w };
+		return { vld1q_f32(values) };
+#endif
+	}
+
+	static _FORCE_INLINE_ SimdFloat4 splat(float p_value) {
+#ifdef SIMD_FLOAT4_SSE2
+		return { _mm_set1_ps(p_value) };
+#else
+		return { vdupq_n_f32(p_value) };
+#endif
+	}
+
+	_FORCE_INLINE_ void store(float *r_ptr) const {
+#ifdef SIMD_FLOAT4_SSE2
+		_mm_storeu_ps(r_ptr, v);
+#else
+		vst1q_f32(r_ptr, v);
+#endif
+	}
+
+	// Stores the first three lanes only, the memory after them is left untouched.
+	_FORCE_INLINE_ void store3(float *r_ptr) const {
+#ifdef SIMD_FLOAT4_SSE2
+		_mm_storel_pi(reinterpret_cast<__m64 *>(r_ptr), v);
+		_mm_store_ss(r_ptr + 2, _mm_movehl_ps(v, v));
+#else
+		vst1_f32(r_ptr, vget_low_f32(v));
+		vst1q_lane_f32(r_ptr + 2, v, 2);
+#endif
+	}
+
+	_FORCE_INLINE_ SimdFloat4 operator+(const SimdFloat4 &p_other) const {
+#ifdef SIMD_FLOAT4_SSE2
+		return { _mm_add_ps(v, p_other.v) };
+#else
+		return { vaddq_f32(v, p_other.v) };
+#endif
+	}
+
+	_FORCE_INLINE_ SimdFloat4 operator-(const SimdFloat4 &p_other) const {
+#ifdef SIMD_FLOAT4_SSE2
+		return { _mm_sub_ps(v, p_other.v) };
+#else
+		return { vsubq_f32(v, p_other.v) };
+#endif
+	}
+
+	_FORCE_INLINE_ SimdFloat4 operator*(const SimdFloat4 &p_other) const {
+#ifdef SIMD_FLOAT4_SSE2
+		return { _mm_mul_ps(v, p_other.v) };
+#else
+		return { vmulq_f32(v, p_other.v) };
+#endif
+	}
+
+	// Returns p_a * p_b + p_c. Not fused, so results match the scalar code.
+	static _FORCE_INLINE_ SimdFloat4 mul_add(const SimdFloat4 &p_a, const SimdFloat4 &p_b, const SimdFloat4 &p_c) {
+		return p_a * p_b + p_c;
+	}
+
+	// Returns a mask with bit i set when lane i is greater than or equal to the same lane of p_other.
+	_FORCE_INLINE_ uint32_t greater_equal_mask(const SimdFloat4 &p_other) const {
+#ifdef SIMD_FLOAT4_SSE2
+		return _mm_movemask_ps(_mm_cmpge_ps(v, p_other.v));
+#else
+		static const uint32_t lane_bits[4] = { 1, 2, 4, 8 };
+		return vaddvq_u32(vandq_u32(vcgeq_f32(v, p_other.v), vld1q_u32(lane_bits)));
+#endif
+	}
+};
+
+#endif // SIMD_FLOAT4_ENABLED
+
+#endif // SIMD_H
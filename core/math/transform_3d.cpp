@@ -31,6 +31,7 @@
 #include "transform_3d.h"
 
 #include "core/math/math_funcs.h"
+#include "core/math/simd.h"
 #include "core/string/ustring.h"
 
 void Transform3D::affine_invert() {
@@ -111,6 +112,55 @@ Transform3D Transform3D::interpolate_with(const Transform3D &p_transform, real_t
 	return interp;
 }
 
+void Transform3D::xform_batch(const Vector3 *p_src, Vector3 *r_dst, uint32_t p_count) const {
+#ifdef SIMD_FLOAT4_ENABLED
+	// Basis columns, so every point is a sum of three scaled columns plus the origin.
+	const SimdFloat4 column_x = SimdFloat4::set(basis.rows[0].x, basis.rows[1].x, basis.rows[2].x, 0);
+	const SimdFloat4 column_y = SimdFloat4::set(basis.rows[0].y, basis.rows[1].y, basis.rows[2].y, 0);
+	const SimdFloat4 column_z = SimdFloat4::set(basis.rows[0].z, basis.rows[1].z, basis.rows[2].z, 0);
+	const SimdFloat4 translation = SimdFloat4::set(origin.x, origin.y, origin.z, 0);
+
+	for (uint32_t i = 0; i < p_count; i++) {
+		SimdFloat4 point = SimdFloat4::splat(p_src[i].x) * column_x;
+		point = SimdFloat4::mul_add(SimdFloat4::splat(p_src[i].y), column_y, point);
+		point = SimdFloat4::mul_add(SimdFloat4::splat(p_src[i].z), column_z, point);
+		// Only three lanes are written, so transforming in place is safe.
+		(point + translation).store3(r_dst[i].coord);
+	}
+#else
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_dst[i] = xform(p_src[i]);
+	}
+#endif
+}
+
+void Transform3D::mult_store_3x4(const Transform3D &p_transform, float *r_rows) const {
+#ifdef SIMD_FLOAT4_ENABLED
+	// Each output row is a combination of the rows of p_transform (with their origin component),
+	// summed in the same order as the scalar product so both give the same result.
+	const SimdFloat4 rows[3] = {
+		SimdFloat4::set(p_transform.basis.rows[0].x, p_transform.basis.rows[0].y, p_transform.basis.rows[0].z, p_transform.origin.x),
+		SimdFloat4::set(p_transform.basis.rows[1].x, p_transform.basis.rows[1].y, p_transform.basis.rows[1].z, p_transform.origin.y),
+		SimdFloat4::set(p_transform.basis.rows[2].x, p_transform.basis.rows[2].y, p_transform.basis.rows[2].z, p_transform.origin.z),
+	};
+	for (int i = 0; i < 3; i++) {
+		SimdFloat4 row = SimdFloat4::splat(basis.rows[i].x) * rows[0];
+		row = SimdFloat4::mul_add(SimdFloat4::splat(basis.rows[i].y), rows[1], row);
+		row = SimdFloat4::mul_add(SimdFloat4::splat(basis.rows[i].z), rows[2], row);
+		row = row + SimdFloat4::set(0, 0, 0, origin[i]);
+		row.store(r_rows + i * 4);
+	}
+#else
+	const Transform3D t = *this * p_transform;
+	for (int i = 0; i < 3; i++) {
+		r_rows[i * 4 + 0] = t.basis.rows[i].x;
+		r_rows[i * 4 + 1] = t.basis.rows[i].y;
+		r_rows[i * 4 + 2] = t.basis.rows[i].z;
+		r_rows[i * 4 + 3] = t.origin[i];
+	}
+#endif
+}
+
 void Transform3D::scale(const Vector3 &p_scale) {
 	basis.scale(p_scale);
 	origin *= p_scale;
@@ -83,6 +83,8 @@ struct _NO_DISCARD_ Transform3D {
 	_FORCE_INLINE_ Vector3 xform(const Vector3 &p_vector) const;
 	_FORCE_INLINE_ AABB xform(const AABB &p_aabb) const;
 	_FORCE_INLINE_ Vector<Vector3> xform(const Vector<Vector3> &p_array) const;
+	// Transforms p_count points, p_src and r_dst may be the same array.
+	void xform_batch(const Vector3 *p_src, Vector3 *r_dst, uint32_t p_count) const;
 
 	// NOTE: These are UNSAFE with non-uniform scaling, and will produce incorrect results.
 	// They use the transpose.
@@ -109,6 +111,9 @@ struct _NO_DISCARD_ Transform3D {
 
 	Transform3D interpolate_with(const Transform3D &p_transform, real_t p_c) const;
 
+	// Stores (*this * p_transform) as a row-major 3x4 matrix, the layout of instance transforms in the RenderingServer.
+	void mult_store_3x4(const Transform3D &p_transform, float *r_rows) const;
+
 	_FORCE_INLINE_ Transform3D inverse_xform(const Transform3D &t) const {
 		Vector3 v = t.origin - origin;
 		return Transform3D(basis.transpose_xform(t.basis),
@@ -214,13 +219,7 @@ _FORCE_INLINE_ AABB Transform3D::xform_inv(const AABB &p_aabb) const {
 Vector<Vector3> Transform3D::xform(const Vector<Vector3> &p_array) const {
 	Vector<Vector3> array;
 	array.resize(p_array.size());
-
-	const Vector3 *r = p_array.ptr();
-	Vector3 *w = array.ptrw();
-
-	for (int i = 0; i < p_array.size(); ++i) {
-		w[i] = xform(r[i]);
-	}
+	xform_batch(p_array.ptr(), array.ptrw(), p_array.size());
 	return array;
 }
 
@@ -120,6 +120,35 @@ public:
 
 	virtual void ptrcall(Object *p_object, const void **p_args, void *r_ret) const = 0;
 
+	// Typed call that skips Variant entirely. Arguments are passed by pointer and are
+	// only converted when their ptrcall encoding differs from their C++ type. The caller
+	// is responsible for matching the bound signature and keeping the arguments alive.
+	template <typename R = void, typename... P>
+	_FORCE_INLINE_ R ptrcall_typed(Object *p_object, const P &...p_args) const {
+		return _ptrcall_typed<R>(p_object, PtrcallArgument<P>(p_args)...);
+	}
+
+protected:
+	// Like ptrcall(), but the arguments are owned by the caller for the whole call,
+	// so binds may read them in place (see PtrToArgBorrowed).
+	virtual void ptrcall_borrowed(Object *p_object, const void **p_args, void *r_ret) const {
+		ptrcall(p_object, p_args, r_ret);
+	}
+
+private:
+	template <typename R, typename... A>
+	_FORCE_INLINE_ R _ptrcall_typed(Object *p_object, const A &...p_args) const {
+		const void *args[sizeof...(A) + 1] = { p_args.ptr()..., nullptr };
+		if constexpr (std::is_void_v<R>) {
+			ptrcall_borrowed(p_object, args, nullptr);
+		} else {
+			typename PtrToArg<R>::EncodeT ret = {};
+			ptrcall_borrowed(p_object, args, &ret);
+			return PtrToArg<R>::convert(&ret);
+		}
+	}
+
+public:
 	StringName get_name() const;
 	void set_name(const StringName &p_name);
 	_FORCE_INLINE_ int get_method_id() const { return method_id; }
@@ -369,6 +398,17 @@ public:
 #endif
 	}
 
+	virtual void ptrcall_borrowed(Object *p_object, const void **p_args, void *r_ret) const override {
+#ifdef TOOLS_ENABLED
+		ERR_FAIL_COND_MSG(p_object && p_object->is_extension_placeholder() && p_object->get_class_name() == get_instance_class(), vformat("Cannot call method bind '%s' on placeholder instance.", MethodBind::get_name()));
+#endif
+#ifdef TYPED_METHOD_BIND
+		call_with_ptr_args_borrowed<T, P...>(static_cast<T *>(p_object), method, p_args);
+#else
+		call_with_ptr_args_borrowed<MB_T, P...>(reinterpret_cast<MB_T *>(p_object), method, p_args);
+#endif
+	}
+
 	MethodBindT(void (MB_T::*p_method)(P...)) {
 		method = p_method;
 		_generate_argument_types(sizeof...(P));
@@ -453,6 +493,17 @@ public:
 #endif
 	}
 
+	virtual void ptrcall_borrowed(Object *p_object, const void **p_args, void *r_ret) const override {
+#ifdef TOOLS_ENABLED
+		ERR_FAIL_COND_MSG(p_object && p_object->is_extension_placeholder() && p_object->get_class_name() == get_instance_class(), vformat("Cannot call method bind '%s' on placeholder instance.", MethodBind::get_name()));
+#endif
+#ifdef TYPED_METHOD_BIND
+		call_with_ptr_argsc_borrowed<T, P...>(static_cast<T *>(p_object), method, p_args);
+#else
+		call_with_ptr_argsc_borrowed<MB_T, P...>(reinterpret_cast<MB_T *>(p_object), method, p_args);
+#endif
+	}
+
 	MethodBindTC(void (MB_T::*p_method)(P...) const) {
 		method = p_method;
 		_set_const(true);
@@ -548,6 +599,17 @@ public:
 #endif
 	}
 
+	virtual void ptrcall_borrowed(Object *p_object, const void **p_args, void *r_ret) const override {
+#ifdef TOOLS_ENABLED
+		ERR_FAIL_COND_MSG(p_object && p_object->is_extension_placeholder() && p_object->get_class_name() == get_instance_class(), vformat("Cannot call method bind '%s' on placeholder instance.", MethodBind::get_name()));
+#endif
+#ifdef TYPED_METHOD_BIND
+		call_with_ptr_args_ret_borrowed<T, R, P...>(static_cast<T *>(p_object), method, p_args, r_ret);
+#else
+		call_with_ptr_args_ret_borrowed<MB_T, R, P...>(reinterpret_cast<MB_T *>(p_object), method, p_args, r_ret);
+#endif
+	}
+
 	MethodBindTR(R (MB_T::*p_method)(P...)) {
 		method = p_method;
 		_set_returns(true);
@@ -644,6 +706,17 @@ public:
 #endif
 	}
 
+	virtual void ptrcall_borrowed(Object *p_object, const void **p_args, void *r_ret) const override {
+#ifdef TOOLS_ENABLED
+		ERR_FAIL_COND_MSG(p_object && p_object->is_extension_placeholder() && p_object->get_class_name() == get_instance_class(), vformat("Cannot call method bind '%s' on placeholder instance.", MethodBind::get_name()));
+#endif
+#ifdef TYPED_METHOD_BIND
+		call_with_ptr_args_retc_borrowed<T, R, P...>(static_cast<T *>(p_object), method, p_args, r_ret);
+#else
+		call_with_ptr_args_retc_borrowed<MB_T, R, P...>(reinterpret_cast<MB_T *>(p_object), method, p_args, r_ret);
+#endif
+	}
+
 	MethodBindTRC(R (MB_T::*p_method)(P...) const) {
 		method = p_method;
 		_set_returns(true);
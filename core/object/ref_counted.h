@@ -271,6 +271,22 @@ struct PtrToArg<const Ref<T> &> {
 	}
 };
 
+template <typename T>
+struct PtrToArgBorrowed<const Ref<T> &> {
+	_FORCE_INLINE_ static const Ref<T> &convert(const void *p_ptr) {
+		// Ref<T> has the same layout as the object pointer p_ptr points to, and the
+		// caller holds a reference for the whole call, so no new one is taken.
+		static_assert(sizeof(Ref<T>) == sizeof(T *));
+		if (p_ptr == nullptr) {
+			return null_ref;
+		}
+		return *reinterpret_cast<const Ref<T> *>(p_ptr);
+	}
+
+private:
+	static inline const Ref<T> null_ref;
+};
+
 template <typename T>
 struct GetTypeInfo<Ref<T>> {
 	static const Variant::Type VARIANT_TYPE = Variant::OBJECT;
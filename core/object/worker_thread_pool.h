@@ -228,6 +228,7 @@ public:
 	void wait_for_group_task_completion(GroupID p_group);
 
 	_FORCE_INLINE_ int get_thread_count() const { return threads.size(); }
+	_FORCE_INLINE_ int get_low_priority_thread_count() const { return threads.size() ? max_low_priority_threads : 0; }
 
 	static WorkerThreadPool *get_singleton() { return singleton; }
 	static int get_thread_index();
@@ -61,10 +61,18 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #ifdef DEBUG_ENABLED
 SafeNumeric<uint64_t> Memory::mem_usage;
 SafeNumeric<uint64_t> Memory::max_usage;
+SafeNumeric<uint64_t> Memory::tag_mem_usage[TAG_MAX];
+SafeNumeric<uint64_t> Memory::tag_max_usage[TAG_MAX];
+SafeNumeric<uint64_t> Memory::tag_alloc_count[TAG_MAX];
+#else
+bool Memory::tag_counting = false;
+std::atomic<uint64_t> Memory::tag_alloc_count[TAG_MAX] = {};
 #endif
 
 SafeNumeric<uint64_t> Memory::alloc_count;
 
+thread_local Memory::Tag Memory::current_tag = Memory::TAG_GENERAL;
+
 void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 #ifdef DEBUG_ENABLED
 	bool prepad = true;
@@ -78,15 +86,27 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 
 	alloc_count.increment();
 
+#ifndef DEBUG_ENABLED
+	if (unlikely(tag_counting)) {
+		tag_alloc_count[current_tag].fetch_add(1, std::memory_order_relaxed);
+	}
+#endif
+
 	if (prepad) {
 		uint8_t *s8 = (uint8_t *)mem;
 
 		uint64_t *s = (uint64_t *)(s8 + SIZE_OFFSET);
-		*s = p_bytes;
-
 #ifdef DEBUG_ENABLED
+		Tag tag = current_tag;
+		*s = p_bytes | (uint64_t(tag) << TAG_SHIFT);
+
+		tag_alloc_count[tag].increment();
 		uint64_t new_mem_usage = mem_usage.add(p_bytes);
 		max_usage.exchange_if_greater(new_mem_usage);
+		uint64_t new_tag_mem_usage = tag_mem_usage[tag].add(p_bytes);
+		tag_max_usage[tag].exchange_if_greater(new_tag_mem_usage);
+#else
+		*s = p_bytes;
 #endif
 		return s8 + DATA_OFFSET;
 	} else {
@@ -110,28 +130,37 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 	if (prepad) {
 		mem -= DATA_OFFSET;
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
+		uint64_t tag_bits = *s & ~SIZE_MASK;
 
 #ifdef DEBUG_ENABLED
-		if (p_bytes > *s) {
-			uint64_t new_mem_usage = mem_usage.add(p_bytes - *s);
+		uint64_t old_bytes = *s & SIZE_MASK;
+		Tag tag = Tag(tag_bits >> TAG_SHIFT);
+		if (p_bytes > old_bytes) {
+			uint64_t new_mem_usage = mem_usage.add(p_bytes - old_bytes);
 			max_usage.exchange_if_greater(new_mem_usage);
+			uint64_t new_tag_mem_usage = tag_mem_usage[tag].add(p_bytes - old_bytes);
+			tag_max_usage[tag].exchange_if_greater(new_tag_mem_usage);
 		} else {
-			mem_usage.sub(*s - p_bytes);
+			mem_usage.sub(old_bytes - p_bytes);
+			tag_mem_usage[tag].sub(old_bytes - p_bytes);
 		}
 #endif
 
 		if (p_bytes == 0) {
+#ifdef DEBUG_ENABLED
+			tag_alloc_count[tag].decrement();
+#endif
 			free(mem);
 			return nullptr;
 		} else {
-			*s = p_bytes;
+			*s = p_bytes | tag_bits;
 
 			mem = (uint8_t *)realloc(mem, p_bytes + DATA_OFFSET);
 			ERR_FAIL_NULL_V(mem, nullptr);
 
 			s = (uint64_t *)(mem + SIZE_OFFSET);
 
-			*s = p_bytes;
+			*s = p_bytes | tag_bits;
 
 			return mem + DATA_OFFSET;
 		}
@@ -162,7 +191,9 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 
 #ifdef DEBUG_ENABLED
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
-		mem_usage.sub(*s);
+		mem_usage.sub(*s & SIZE_MASK);
+		tag_mem_usage[*s >> TAG_SHIFT].sub(*s & SIZE_MASK);
+		tag_alloc_count[*s >> TAG_SHIFT].decrement();
 #endif
 
 		free(mem);
@@ -191,6 +222,56 @@ uint64_t Memory::get_mem_max_usage() {
 #endif
 }
 
+uint64_t Memory::get_tag_mem_usage(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_mem_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_tag_mem_max_usage(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_max_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_tag_alloc_count(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_alloc_count[p_tag].get();
+#else
+	return tag_alloc_count[p_tag].load(std::memory_order_relaxed);
+#endif
+}
+
+void Memory::reset_tag_stats(Tag p_tag) {
+	ERR_FAIL_INDEX(p_tag, TAG_MAX);
+#ifdef DEBUG_ENABLED
+	tag_max_usage[p_tag].set(tag_mem_usage[p_tag].get());
+#else
+	tag_alloc_count[p_tag].store(0, std::memory_order_relaxed);
+#endif
+}
+
+void Memory::set_tag_counting_enabled(bool p_enabled) {
+#ifndef DEBUG_ENABLED
+	tag_counting = p_enabled;
+#endif
+}
+
+bool Memory::is_tag_counting_enabled() {
+#ifdef DEBUG_ENABLED
+	return true;
+#else
+	return tag_counting;
+#endif
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
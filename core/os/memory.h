@@ -39,13 +39,40 @@
 #include <type_traits>
 
 class Memory {
+public:
+	// Subsystems tag the allocations they make (see MemoryTagScope), so their memory
+	// can be accounted for separately. Debug builds keep the tag in the allocation header
+	// and track live usage per tag. Release builds have no header to read it back from on
+	// free, so they can only count the allocations made per tag, and only when enabled.
+	enum Tag : uint8_t {
+		TAG_GENERAL,
+		TAG_RENDERING,
+		TAG_PHYSICS,
+		TAG_SCRIPT,
+		TAG_RESOURCES,
+		TAG_MAX
+	};
+
+private:
 #ifdef DEBUG_ENABLED
 	static SafeNumeric<uint64_t> mem_usage;
 	static SafeNumeric<uint64_t> max_usage;
+	static SafeNumeric<uint64_t> tag_mem_usage[TAG_MAX];
+	static SafeNumeric<uint64_t> tag_max_usage[TAG_MAX];
+	static SafeNumeric<uint64_t> tag_alloc_count[TAG_MAX];
+#else
+	static bool tag_counting;
+	static std::atomic<uint64_t> tag_alloc_count[TAG_MAX];
 #endif
 
 	static SafeNumeric<uint64_t> alloc_count;
 
+	static thread_local Tag current_tag;
+
+	// The tag is stored in the upper bits of the allocation size in the header.
+	static constexpr int TAG_SHIFT = 56;
+	static constexpr uint64_t SIZE_MASK = (uint64_t(1) << TAG_SHIFT) - 1;
+
 public:
 	// Alignment:  ↓ max_align_t        ↓ uint64_t          ↓ max_align_t
 	//             ┌─────────────────┬──┬────────────────┬──┬───────────...
@@ -65,6 +92,34 @@ public:
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+
+	_FORCE_INLINE_ static Tag get_current_tag() { return current_tag; }
+	_FORCE_INLINE_ static void set_current_tag(Tag p_tag) { current_tag = p_tag; }
+
+	static uint64_t get_tag_mem_usage(Tag p_tag);
+	static uint64_t get_tag_mem_max_usage(Tag p_tag);
+	// Live allocations in debug builds, allocations made since the last reset in release builds.
+	static uint64_t get_tag_alloc_count(Tag p_tag);
+	// Resets the peak usage of the tag to its current usage, or its allocation count in release builds.
+	static void reset_tag_stats(Tag p_tag);
+	// Release builds only count tagged allocations while enabled, debug builds always track them.
+	static void set_tag_counting_enabled(bool p_enabled);
+	static bool is_tag_counting_enabled();
+};
+
+// Tags the allocations made by the current thread while in scope.
+class MemoryTagScope {
+	Memory::Tag previous_tag;
+
+public:
+	_FORCE_INLINE_ explicit MemoryTagScope(Memory::Tag p_tag) {
+		previous_tag = Memory::get_current_tag();
+		Memory::set_current_tag(p_tag);
+	}
+
+	_FORCE_INLINE_ ~MemoryTagScope() {
+		Memory::set_current_tag(previous_tag);
+	}
 };
 
 class DefaultAllocator {
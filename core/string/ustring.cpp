@@ -686,10 +686,20 @@ bool String::operator==(const String &p_str) const {
 		return true;
 	}
 
-	int l = length();
-
 	const char32_t *src = get_data();
 	const char32_t *dst = p_str.get_data();
+	if (src == dst) {
+		return true; // Same buffer.
+	}
+
+	// Strings whose hashes were already computed can be told apart without comparing them.
+	uint32_t src_hash = _cowdata._get_hash()->get();
+	uint32_t dst_hash = p_str._cowdata._get_hash()->get();
+	if (src_hash && dst_hash && src_hash != dst_hash) {
+		return false;
+	}
+
+	int l = length();
 
 	/* Compare char by char */
 	for (int i = 0; i < l; i++) {
@@ -3058,6 +3068,16 @@ uint32_t String::hash(const char32_t *p_cstr) {
 }
 
 uint32_t String::hash() const {
+	// The hash is cached in the string's buffer, which resets it when written to.
+	// Zero means it hasn't been computed yet.
+	SafeNumeric<uint32_t> *cached_hash = _cowdata._get_hash();
+	if (cached_hash) {
+		uint32_t hashv = cached_hash->get();
+		if (hashv) {
+			return hashv;
+		}
+	}
+
 	/* simple djb2 hashing */
 
 	const char32_t *chr = get_data();
@@ -3069,6 +3089,9 @@ uint32_t String::hash() const {
 		c = *chr++;
 	}
 
+	if (cached_hash) {
+		cached_hash->set(hashv);
+	}
 	return hashv;
 }
 
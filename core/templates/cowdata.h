@@ -89,23 +89,30 @@ private:
 		return ++x;
 	}
 
-	// Alignment:  ↓ max_align_t           ↓ USize          ↓ max_align_t
-	//             ┌────────────────────┬──┬─────────────┬──┬───────────...
-	//             │ SafeNumeric<USize> │░░│ USize       │░░│ T[]
-	//             │ ref. count         │░░│ data size   │░░│ data
-	//             └────────────────────┴──┴─────────────┴──┴───────────...
-	// Offset:     ↑ REF_COUNT_OFFSET      ↑ SIZE_OFFSET    ↑ DATA_OFFSET
+	// Alignment:  ↓ max_align_t              ↓ uint32_t                 ↓ USize          ↓ max_align_t
+	//             ┌───────────────────────┬──┬───────────────────────┬──┬─────────────┬──┬───────────...
+	//             │ SafeNumeric<uint32_t> │░░│ SafeNumeric<uint32_t> │░░│ USize       │░░│ T[]
+	//             │ ref. count            │░░│ hash cache            │░░│ data size   │░░│ data
+	//             └───────────────────────┴──┴───────────────────────┴──┴─────────────┴──┴───────────...
+	// Offset:     ↑ REF_COUNT_OFFSET         ↑ HASH_OFFSET              ↑ SIZE_OFFSET    ↑ DATA_OFFSET
+	//
+	// The hash cache is only used by String, it's reset whenever the data is accessed for writing.
 
 	static constexpr size_t REF_COUNT_OFFSET = 0;
-	static constexpr size_t SIZE_OFFSET = ((REF_COUNT_OFFSET + sizeof(SafeNumeric<USize>)) % alignof(USize) == 0) ? (REF_COUNT_OFFSET + sizeof(SafeNumeric<USize>)) : ((REF_COUNT_OFFSET + sizeof(SafeNumeric<USize>)) + alignof(USize) - ((REF_COUNT_OFFSET + sizeof(SafeNumeric<USize>)) % alignof(USize)));
+	static constexpr size_t HASH_OFFSET = ((REF_COUNT_OFFSET + sizeof(SafeNumeric<uint32_t>)) % alignof(uint32_t) == 0) ? (REF_COUNT_OFFSET + sizeof(SafeNumeric<uint32_t>)) : ((REF_COUNT_OFFSET + sizeof(SafeNumeric<uint32_t>)) + alignof(uint32_t) - ((REF_COUNT_OFFSET + sizeof(SafeNumeric<uint32_t>)) % alignof(uint32_t)));
+	static constexpr size_t SIZE_OFFSET = ((HASH_OFFSET + sizeof(SafeNumeric<uint32_t>)) % alignof(USize) == 0) ? (HASH_OFFSET + sizeof(SafeNumeric<uint32_t>)) : ((HASH_OFFSET + sizeof(SafeNumeric<uint32_t>)) + alignof(USize) - ((HASH_OFFSET + sizeof(SafeNumeric<uint32_t>)) % alignof(USize)));
 	static constexpr size_t DATA_OFFSET = ((SIZE_OFFSET + sizeof(USize)) % alignof(max_align_t) == 0) ? (SIZE_OFFSET + sizeof(USize)) : ((SIZE_OFFSET + sizeof(USize)) + alignof(max_align_t) - ((SIZE_OFFSET + sizeof(USize)) % alignof(max_align_t)));
 
 	mutable T *_ptr = nullptr;
 
 	// internal helpers
 
-	static _FORCE_INLINE_ SafeNumeric<USize> *_get_refcount_ptr(uint8_t *p_ptr) {
-		return (SafeNumeric<USize> *)(p_ptr + REF_COUNT_OFFSET);
+	static _FORCE_INLINE_ SafeNumeric<uint32_t> *_get_refcount_ptr(uint8_t *p_ptr) {
+		return (SafeNumeric<uint32_t> *)(p_ptr + REF_COUNT_OFFSET);
+	}
+
+	static _FORCE_INLINE_ SafeNumeric<uint32_t> *_get_hash_ptr(uint8_t *p_ptr) {
+		return (SafeNumeric<uint32_t> *)(p_ptr + HASH_OFFSET);
 	}
 
 	static _FORCE_INLINE_ USize *_get_size_ptr(uint8_t *p_ptr) {
@@ -116,12 +123,20 @@ private:
 		return (T *)(p_ptr + DATA_OFFSET);
 	}
 
-	_FORCE_INLINE_ SafeNumeric<USize> *_get_refcount() const {
+	_FORCE_INLINE_ SafeNumeric<uint32_t> *_get_refcount() const {
+		if (!_ptr) {
+			return nullptr;
+		}
+
+		return (SafeNumeric<uint32_t> *)((uint8_t *)_ptr - DATA_OFFSET + REF_COUNT_OFFSET);
+	}
+
+	_FORCE_INLINE_ SafeNumeric<uint32_t> *_get_hash() const {
 		if (!_ptr) {
 			return nullptr;
 		}
 
-		return (SafeNumeric<USize> *)((uint8_t *)_ptr - DATA_OFFSET + REF_COUNT_OFFSET);
+		return (SafeNumeric<uint32_t> *)((uint8_t *)_ptr - DATA_OFFSET + HASH_OFFSET);
 	}
 
 	_FORCE_INLINE_ USize *_get_size() const {
@@ -247,7 +262,7 @@ void CowData<T>::_unref(void *p_data) {
 		return;
 	}
 
-	SafeNumeric<USize> *refc = _get_refcount();
+	SafeNumeric<uint32_t> *refc = _get_refcount();
 
 	if (refc->decrement() > 0) {
 		return; // still in use
@@ -274,7 +289,7 @@ typename CowData<T>::USize CowData<T>::_copy_on_write() {
 		return 0;
 	}
 
-	SafeNumeric<USize> *refc = _get_refcount();
+	SafeNumeric<uint32_t> *refc = _get_refcount();
 
 	USize rc = refc->get();
 	if (unlikely(rc > 1)) {
@@ -284,11 +299,12 @@ typename CowData<T>::USize CowData<T>::_copy_on_write() {
 		uint8_t *mem_new = (uint8_t *)Memory::alloc_static(_get_alloc_size(current_size) + DATA_OFFSET, false);
 		ERR_FAIL_NULL_V(mem_new, 0);
 
-		SafeNumeric<USize> *_refc_ptr = _get_refcount_ptr(mem_new);
+		SafeNumeric<uint32_t> *_refc_ptr = _get_refcount_ptr(mem_new);
 		USize *_size_ptr = _get_size_ptr(mem_new);
 		T *_data_ptr = _get_data_ptr(mem_new);
 
-		new (_refc_ptr) SafeNumeric<USize>(1); //refcount
+		new (_refc_ptr) SafeNumeric<uint32_t>(1); //refcount
+		new (_get_hash_ptr(mem_new)) SafeNumeric<uint32_t>(0); //hash cache
 		*(_size_ptr) = current_size; //size
 
 		// initialize new elements
@@ -304,6 +320,9 @@ typename CowData<T>::USize CowData<T>::_copy_on_write() {
 		_ptr = _data_ptr;
 
 		rc = 1;
+	} else if constexpr (std::is_same_v<T, char32_t>) {
+		// The caller is about to modify the data.
+		_get_hash()->set(0);
 	}
 	return rc;
 }
@@ -340,11 +359,12 @@ Error CowData<T>::resize(Size p_size) {
 				uint8_t *mem_new = (uint8_t *)Memory::alloc_static(alloc_size + DATA_OFFSET, false);
 				ERR_FAIL_NULL_V(mem_new, ERR_OUT_OF_MEMORY);
 
-				SafeNumeric<USize> *_refc_ptr = _get_refcount_ptr(mem_new);
+				SafeNumeric<uint32_t> *_refc_ptr = _get_refcount_ptr(mem_new);
 				USize *_size_ptr = _get_size_ptr(mem_new);
 				T *_data_ptr = _get_data_ptr(mem_new);
 
-				new (_refc_ptr) SafeNumeric<USize>(1); //refcount
+				new (_refc_ptr) SafeNumeric<uint32_t>(1); //refcount
+				new (_get_hash_ptr(mem_new)) SafeNumeric<uint32_t>(0); //hash cache
 				*(_size_ptr) = 0; //size, currently none
 
 				_ptr = _data_ptr;
@@ -353,10 +373,10 @@ Error CowData<T>::resize(Size p_size) {
 				uint8_t *mem_new = (uint8_t *)Memory::realloc_static(((uint8_t *)_ptr) - DATA_OFFSET, alloc_size + DATA_OFFSET, false);
 				ERR_FAIL_NULL_V(mem_new, ERR_OUT_OF_MEMORY);
 
-				SafeNumeric<USize> *_refc_ptr = _get_refcount_ptr(mem_new);
+				SafeNumeric<uint32_t> *_refc_ptr = _get_refcount_ptr(mem_new);
 				T *_data_ptr = _get_data_ptr(mem_new);
 
-				new (_refc_ptr) SafeNumeric<USize>(rc); //refcount
+				new (_refc_ptr) SafeNumeric<uint32_t>(rc); //refcount
 
 				_ptr = _data_ptr;
 			}
@@ -387,10 +407,10 @@ Error CowData<T>::resize(Size p_size) {
 			uint8_t *mem_new = (uint8_t *)Memory::realloc_static(((uint8_t *)_ptr) - DATA_OFFSET, alloc_size + DATA_OFFSET, false);
 			ERR_FAIL_NULL_V(mem_new, ERR_OUT_OF_MEMORY);
 
-			SafeNumeric<USize> *_refc_ptr = _get_refcount_ptr(mem_new);
+			SafeNumeric<uint32_t> *_refc_ptr = _get_refcount_ptr(mem_new);
 			T *_data_ptr = _get_data_ptr(mem_new);
 
-			new (_refc_ptr) SafeNumeric<USize>(rc); //refcount
+			new (_refc_ptr) SafeNumeric<uint32_t>(rc); //refcount
 
 			_ptr = _data_ptr;
 		}
@@ -0,0 +1,641 @@
+/**************************************************************************/
+/*  ordered_hash_map.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef ORDERED_HASH_MAP_H
+#define ORDERED_HASH_MAP_H
+
+#include "core/os/memory.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/pair.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ORDERED_HASH_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/**
+ * An insertion-ordered HashMap using open addressing with SIMD group probing
+ * (as in "Swiss tables").
+ *
+ * Keys and values are stored by insertion order in a dense entry array. It's
+ * split in chunks of growing size, so entries never move when the map grows
+ * and pointers to them remain valid after insertions, like with HashMap.
+ *
+ * The index is a table of one control byte per slot plus the entry index of
+ * the slot. Control bytes hold 7 bits of the hash of used slots, so lookups
+ * compare groups of 16 slots at once and only touch entries whose bits match.
+ *
+ * Erasing leaves a hole in the entry array. Holes are skipped when iterating,
+ * and the entries are compacted once the map has more holes than elements,
+ * which moves the entries and invalidates pointers and iterators to them.
+ *
+ * The assignment operator copy the pairs from one map to the other.
+ */
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class OrderedHashMap {
+public:
+	static constexpr uint32_t GROUP_WIDTH = 16;
+	static constexpr uint32_t MIN_CAPACITY = GROUP_WIDTH;
+
+private:
+	static constexpr uint8_t CTRL_EMPTY = 0x80;
+	static constexpr uint8_t CTRL_DELETED = 0xFE;
+	static constexpr uint32_t FIRST_CHUNK_SHIFT = 3; // The first chunk holds 8 entries, each next one twice as many as the previous.
+	static constexpr uint32_t MIN_COMPACT_HOLES = 16;
+
+	struct Entry {
+		alignas(KeyValue<TKey, TValue>) uint8_t data[sizeof(KeyValue<TKey, TValue>)];
+		uint32_t hash;
+		bool used;
+
+		_FORCE_INLINE_ KeyValue<TKey, TValue> &get() { return *reinterpret_cast<KeyValue<TKey, TValue> *>(data); }
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> &get() const { return *reinterpret_cast<const KeyValue<TKey, TValue> *>(data); }
+	};
+
+	// Index.
+	uint8_t *ctrl = nullptr;
+	uint32_t *slots = nullptr;
+	uint32_t capacity = 0;
+	uint32_t growth_left = 0; // Empty slots that can still be used before rehashing.
+
+	// Entries.
+	Entry **chunks = nullptr;
+	uint32_t chunk_count = 0;
+	uint32_t entry_count = 0; // Including holes.
+	uint32_t num_elements = 0;
+
+	static _FORCE_INLINE_ uint32_t _log2(uint32_t p_value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long index;
+		_BitScanReverse(&index, p_value);
+		return index;
+#else
+		return 31 - __builtin_clz(p_value);
+#endif
+	}
+
+	static _FORCE_INLINE_ uint32_t _lowest_bit(uint32_t p_mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long index;
+		_BitScanForward(&index, p_mask);
+		return index;
+#else
+		return __builtin_ctz(p_mask);
+#endif
+	}
+
+	// Group matching, each returns a mask with a bit set for every matching slot of the group.
+
+	static _FORCE_INLINE_ uint32_t _match(const uint8_t *p_group, uint8_t p_ctrl) {
+#ifdef ORDERED_HASH_MAP_SSE2
+		__m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_group));
+		return _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(p_ctrl))));
+#else
+		uint32_t mask = 0;
+		for (uint32_t i = 0; i < GROUP_WIDTH; i++) {
+			mask |= uint32_t(p_group[i] == p_ctrl) << i;
+		}
+		return mask;
+#endif
+	}
+
+	static _FORCE_INLINE_ uint32_t _match_empty_or_deleted(const uint8_t *p_group) {
+#ifdef ORDERED_HASH_MAP_SSE2
+		// Both have the high bit set, used slots don't.
+		return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p_group)));
+#else
+		uint32_t mask = 0;
+		for (uint32_t i = 0; i < GROUP_WIDTH; i++) {
+			mask |= uint32_t(p_group[i] >> 7) << i;
+		}
+		return mask;
+#endif
+	}
+
+	static _FORCE_INLINE_ uint8_t _get_h2(uint32_t p_hash) { return p_hash & 0x7F; }
+	_FORCE_INLINE_ uint32_t _get_first_group(uint32_t p_hash) const { return (p_hash >> 7) & ((capacity / GROUP_WIDTH) - 1); }
+	_FORCE_INLINE_ uint32_t _get_max_load() const { return capacity - capacity / 8; }
+
+	_FORCE_INLINE_ Entry *_get_entry(uint32_t p_index) const {
+		const uint32_t chunk = _log2((p_index >> FIRST_CHUNK_SHIFT) + 1);
+		return &chunks[chunk][p_index - (((1u << chunk) - 1) << FIRST_CHUNK_SHIFT)];
+	}
+
+	bool _lookup_slot(const TKey &p_key, uint32_t p_hash, uint32_t &r_slot) const {
+		if (num_elements == 0) {
+			return false;
+		}
+
+		const uint32_t group_mask = (capacity / GROUP_WIDTH) - 1;
+		const uint8_t h2 = _get_h2(p_hash);
+		uint32_t group = _get_first_group(p_hash);
+
+		// Triangular probing visits every group, and there is always an empty slot somewhere.
+		for (uint32_t probe = 1;; probe++) {
+			const uint8_t *group_ctrl = ctrl + group * GROUP_WIDTH;
+			uint32_t match = _match(group_ctrl, h2);
+			while (match) {
+				const uint32_t slot = group * GROUP_WIDTH + _lowest_bit(match);
+				const Entry *entry = _get_entry(slots[slot]);
+				if (entry->hash == p_hash && Comparator::compare(entry->get().key, p_key)) {
+					r_slot = slot;
+					return true;
+				}
+				match &= match - 1;
+			}
+			if (_match(group_ctrl, CTRL_EMPTY)) {
+				return false;
+			}
+			group = (group + probe) & group_mask;
+		}
+	}
+
+	uint32_t _find_insert_slot(uint32_t p_hash) const {
+		const uint32_t group_mask = (capacity / GROUP_WIDTH) - 1;
+		uint32_t group = _get_first_group(p_hash);
+
+		for (uint32_t probe = 1;; probe++) {
+			const uint32_t match = _match_empty_or_deleted(ctrl + group * GROUP_WIDTH);
+			if (match) {
+				return group * GROUP_WIDTH + _lowest_bit(match);
+			}
+			group = (group + probe) & group_mask;
+		}
+	}
+
+	void _rebuild_index(uint32_t p_capacity) {
+		if (p_capacity != capacity) {
+			if (ctrl) {
+				Memory::free_static(ctrl);
+			}
+			capacity = p_capacity;
+			// Control bytes and slots share a single allocation.
+			ctrl = reinterpret_cast<uint8_t *>(Memory::alloc_static(capacity * (sizeof(uint8_t) + sizeof(uint32_t))));
+			slots = reinterpret_cast<uint32_t *>(ctrl + capacity);
+		}
+
+		memset(ctrl, CTRL_EMPTY, capacity);
+		for (uint32_t i = 0; i < entry_count; i++) {
+			const Entry *entry = _get_entry(i);
+			if (!entry->used) {
+				continue;
+			}
+			const uint32_t slot = _find_insert_slot(entry->hash);
+			ctrl[slot] = _get_h2(entry->hash);
+			slots[slot] = i;
+		}
+		growth_left = _get_max_load() - num_elements;
+	}
+
+	// Moves the entries over the holes left by erased ones, keeping their order.
+	void _compact() {
+		uint32_t dst = 0;
+		for (uint32_t src = 0; src < entry_count; src++) {
+			Entry *src_entry = _get_entry(src);
+			if (!src_entry->used) {
+				continue;
+			}
+			if (src != dst) {
+				Entry *dst_entry = _get_entry(dst);
+				new (dst_entry->data) KeyValue<TKey, TValue>(src_entry->get());
+				dst_entry->hash = src_entry->hash;
+				dst_entry->used = true;
+				src_entry->get().~KeyValue<TKey, TValue>();
+				src_entry->used = false;
+			}
+			dst++;
+		}
+		entry_count = dst;
+		_rebuild_index(capacity);
+	}
+
+	// Returns the index of the entry, or UINT32_MAX if the map is full.
+	uint32_t _insert(const TKey &p_key, const TValue &p_value) {
+		const uint32_t hash = Hasher::hash(p_key);
+		uint32_t slot = 0;
+		if (_lookup_slot(p_key, hash, slot)) {
+			_get_entry(slots[slot])->get().value = p_value;
+			return slots[slot];
+		}
+
+		if (unlikely(ctrl == nullptr)) {
+			_rebuild_index(MIN_CAPACITY);
+		}
+
+		slot = _find_insert_slot(hash);
+		if (unlikely(growth_left == 0 && ctrl[slot] == CTRL_EMPTY)) {
+			// Out of empty slots. Only drop the tombstones if there are many of them, grow otherwise.
+			if (num_elements < _get_max_load() / 2) {
+				_rebuild_index(capacity);
+			} else {
+				ERR_FAIL_COND_V_MSG(capacity >= (1u << 31), UINT32_MAX, "Hash table maximum capacity reached, aborting insertion.");
+				_rebuild_index(capacity * 2);
+			}
+			slot = _find_insert_slot(hash);
+		}
+
+		if (entry_count == ((1u << chunk_count) - 1) << FIRST_CHUNK_SHIFT) {
+			chunks = reinterpret_cast<Entry **>(Memory::realloc_static(chunks, sizeof(Entry *) * (chunk_count + 1)));
+			chunks[chunk_count] = reinterpret_cast<Entry *>(Memory::alloc_static(sizeof(Entry) * (1u << (chunk_count + FIRST_CHUNK_SHIFT))));
+			chunk_count++;
+		}
+
+		Entry *entry = _get_entry(entry_count);
+		new (entry->data) KeyValue<TKey, TValue>(p_key, p_value);
+		entry->hash = hash;
+		entry->used = true;
+
+		if (ctrl[slot] == CTRL_EMPTY) {
+			growth_left--;
+		}
+		ctrl[slot] = _get_h2(hash);
+		slots[slot] = entry_count;
+
+		num_elements++;
+		return entry_count++;
+	}
+
+	void _erase_slot(uint32_t p_slot) {
+		Entry *entry = _get_entry(slots[p_slot]);
+		entry->get().~KeyValue<TKey, TValue>();
+		entry->used = false;
+		num_elements--;
+
+		// If the group still has an empty slot, no probe went past it, so the slot can be marked as empty too.
+		const uint32_t group = p_slot / GROUP_WIDTH;
+		if (_match(ctrl + group * GROUP_WIDTH, CTRL_EMPTY)) {
+			ctrl[p_slot] = CTRL_EMPTY;
+			growth_left++;
+		} else {
+			ctrl[p_slot] = CTRL_DELETED;
+		}
+
+		// Trailing holes can be reused right away.
+		while (entry_count > 0 && !_get_entry(entry_count - 1)->used) {
+			entry_count--;
+		}
+
+		if (num_elements == 0) {
+			// Also drops all tombstones.
+			memset(ctrl, CTRL_EMPTY, capacity);
+			growth_left = _get_max_load();
+		} else if (entry_count - num_elements > MAX(num_elements, MIN_COMPACT_HOLES)) {
+			_compact();
+		}
+	}
+
+	_FORCE_INLINE_ uint32_t _next_used(uint32_t p_index) const {
+		while (p_index < entry_count && !_get_entry(p_index)->used) {
+			p_index++;
+		}
+		return p_index;
+	}
+
+	_FORCE_INLINE_ uint32_t _prev_used(uint32_t p_index) const {
+		while (p_index > 0) {
+			p_index--;
+			if (_get_entry(p_index)->used) {
+				return p_index;
+			}
+		}
+		return entry_count;
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if constexpr (!std::is_trivially_destructible_v<TKey> || !std::is_trivially_destructible_v<TValue>) {
+			for (uint32_t i = 0; i < entry_count; i++) {
+				Entry *entry = _get_entry(i);
+				if (entry->used) {
+					entry->get().~KeyValue<TKey, TValue>();
+				}
+			}
+		}
+		entry_count = 0;
+		num_elements = 0;
+
+		if (ctrl) {
+			memset(ctrl, CTRL_EMPTY, capacity);
+			growth_left = _get_max_load();
+		}
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t slot = 0;
+		bool exists = _lookup_slot(p_key, Hasher::hash(p_key), slot);
+		CRASH_COND_MSG(!exists, "OrderedHashMap key not found.");
+		return _get_entry(slots[slot])->get().value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t slot = 0;
+		bool exists = _lookup_slot(p_key, Hasher::hash(p_key), slot);
+		CRASH_COND_MSG(!exists, "OrderedHashMap key not found.");
+		return _get_entry(slots[slot])->get().value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t slot = 0;
+		if (_lookup_slot(p_key, Hasher::hash(p_key), slot)) {
+			return &_get_entry(slots[slot])->get().value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t slot = 0;
+		if (_lookup_slot(p_key, Hasher::hash(p_key), slot)) {
+			return &_get_entry(slots[slot])->get().value;
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		uint32_t slot = 0;
+		return _lookup_slot(p_key, Hasher::hash(p_key), slot);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t slot = 0;
+		if (!_lookup_slot(p_key, Hasher::hash(p_key), slot)) {
+			return false;
+		}
+		_erase_slot(slot);
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	void reserve(uint32_t p_new_capacity) {
+		uint32_t new_capacity = MAX(capacity, MIN_CAPACITY);
+		while (new_capacity - new_capacity / 8 < p_new_capacity) {
+			ERR_FAIL_COND_MSG(new_capacity >= (1u << 31), "Hash table maximum capacity reached.");
+			new_capacity *= 2;
+		}
+		if (new_capacity != capacity) {
+			_rebuild_index(new_capacity);
+		}
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> &operator*() const {
+			return map->_get_entry(index)->get();
+		}
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> *operator->() const { return &map->_get_entry(index)->get(); }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			if (map && index < map->entry_count) {
+				index = map->_next_used(index + 1);
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ ConstIterator &operator--() {
+			if (map && index < map->entry_count) {
+				index = map->_prev_used(index);
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return _is_end() ? b._is_end() : (map == b.map && index == b.index); }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return !(*this == b); }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return !_is_end();
+		}
+
+		_FORCE_INLINE_ ConstIterator(const OrderedHashMap *p_map, uint32_t p_index) {
+			map = p_map;
+			index = p_index;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+		_FORCE_INLINE_ ConstIterator(const ConstIterator &p_it) {
+			map = p_it.map;
+			index = p_it.index;
+		}
+		_FORCE_INLINE_ void operator=(const ConstIterator &p_it) {
+			map = p_it.map;
+			index = p_it.index;
+		}
+
+	private:
+		_FORCE_INLINE_ bool _is_end() const { return map == nullptr || index >= map->entry_count; }
+
+		const OrderedHashMap *map = nullptr;
+		uint32_t index = 0;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ KeyValue<TKey, TValue> &operator*() const {
+			return map->_get_entry(index)->get();
+		}
+		_FORCE_INLINE_ KeyValue<TKey, TValue> *operator->() const { return &map->_get_entry(index)->get(); }
+		_FORCE_INLINE_ Iterator &operator++() {
+			if (map && index < map->entry_count) {
+				index = map->_next_used(index + 1);
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ Iterator &operator--() {
+			if (map && index < map->entry_count) {
+				index = map->_prev_used(index);
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return _is_end() ? b._is_end() : (map == b.map && index == b.index); }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return !(*this == b); }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return !_is_end();
+		}
+
+		_FORCE_INLINE_ Iterator(OrderedHashMap *p_map, uint32_t p_index) {
+			map = p_map;
+			index = p_index;
+		}
+		_FORCE_INLINE_ Iterator() {}
+		_FORCE_INLINE_ Iterator(const Iterator &p_it) {
+			map = p_it.map;
+			index = p_it.index;
+		}
+		_FORCE_INLINE_ void operator=(const Iterator &p_it) {
+			map = p_it.map;
+			index = p_it.index;
+		}
+
+		operator ConstIterator() const {
+			return ConstIterator(map, index);
+		}
+
+	private:
+		_FORCE_INLINE_ bool _is_end() const { return map == nullptr || index >= map->entry_count; }
+
+		OrderedHashMap *map = nullptr;
+		uint32_t index = 0;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(this, _next_used(0));
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(this, entry_count);
+	}
+	_FORCE_INLINE_ Iterator last() {
+		return Iterator(this, _prev_used(entry_count));
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		uint32_t slot = 0;
+		if (!_lookup_slot(p_key, Hasher::hash(p_key), slot)) {
+			return end();
+		}
+		return Iterator(this, slots[slot]);
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(this, _next_used(0));
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(this, entry_count);
+	}
+	_FORCE_INLINE_ ConstIterator last() const {
+		return ConstIterator(this, _prev_used(entry_count));
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		uint32_t slot = 0;
+		if (!_lookup_slot(p_key, Hasher::hash(p_key), slot)) {
+			return end();
+		}
+		return ConstIterator(this, slots[slot]);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t slot = 0;
+		bool exists = _lookup_slot(p_key, Hasher::hash(p_key), slot);
+		CRASH_COND(!exists);
+		return _get_entry(slots[slot])->get().value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t slot = 0;
+		if (_lookup_slot(p_key, Hasher::hash(p_key), slot)) {
+			return _get_entry(slots[slot])->get().value;
+		}
+		const uint32_t index = _insert(p_key, TValue());
+		CRASH_COND(index == UINT32_MAX);
+		return _get_entry(index)->get().value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		const uint32_t index = _insert(p_key, p_value);
+		if (index == UINT32_MAX) {
+			return end();
+		}
+		return Iterator(this, index);
+	}
+
+	/* Constructors */
+
+	OrderedHashMap(const OrderedHashMap &p_other) {
+		if (p_other.num_elements == 0) {
+			return;
+		}
+
+		reserve(p_other.num_elements);
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			_insert(E.key, E.value);
+		}
+	}
+
+	void operator=(const OrderedHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		clear();
+
+		if (p_other.num_elements == 0) {
+			return; // Nothing to copy.
+		}
+
+		reserve(p_other.num_elements);
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			_insert(E.key, E.value);
+		}
+	}
+
+	OrderedHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	OrderedHashMap() {}
+
+	~OrderedHashMap() {
+		clear();
+
+		for (uint32_t i = 0; i < chunk_count; i++) {
+			Memory::free_static(chunks[i]);
+		}
+		if (chunks) {
+			Memory::free_static(chunks);
+		}
+		if (ctrl) {
+			Memory::free_static(ctrl);
+		}
+	}
+};
+
+#undef ORDERED_HASH_MAP_SSE2
+
+#endif // ORDERED_HASH_MAP_H
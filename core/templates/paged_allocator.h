@@ -52,6 +52,22 @@ class PagedAllocator {
 	uint32_t page_size = 0;
 	SpinLock spin_lock;
 
+	_FORCE_INLINE_ void _add_page() {
+		uint32_t pages_used = pages_allocated;
+
+		pages_allocated++;
+		page_pool = (T **)memrealloc(page_pool, sizeof(T *) * pages_allocated);
+		available_pool = (T ***)memrealloc(available_pool, sizeof(T **) * pages_allocated);
+
+		page_pool[pages_used] = (T *)memalloc(sizeof(T) * page_size);
+		available_pool[pages_used] = (T **)memalloc(sizeof(T *) * page_size);
+
+		for (uint32_t i = 0; i < page_size; i++) {
+			available_pool[0][i] = &page_pool[pages_used][i];
+		}
+		allocs_available += page_size;
+	}
+
 public:
 	template <typename... Args>
 	T *alloc(Args &&...p_args) {
@@ -59,19 +75,7 @@ public:
 			spin_lock.lock();
 		}
 		if (unlikely(allocs_available == 0)) {
-			uint32_t pages_used = pages_allocated;
-
-			pages_allocated++;
-			page_pool = (T **)memrealloc(page_pool, sizeof(T *) * pages_allocated);
-			available_pool = (T ***)memrealloc(available_pool, sizeof(T **) * pages_allocated);
-
-			page_pool[pages_used] = (T *)memalloc(sizeof(T) * page_size);
-			available_pool[pages_used] = (T **)memalloc(sizeof(T *) * page_size);
-
-			for (uint32_t i = 0; i < page_size; i++) {
-				available_pool[0][i] = &page_pool[pages_used][i];
-			}
-			allocs_available += page_size;
+			_add_page();
 		}
 
 		allocs_available--;
@@ -95,6 +99,37 @@ public:
 		}
 	}
 
+	// Batch versions of alloc() and free() that take the lock only once. Elements are
+	// neither constructed nor destructed, they are meant for caches built on top of the allocator.
+	void alloc_batch(T **r_mem, uint32_t p_count) {
+		if (thread_safe) {
+			spin_lock.lock();
+		}
+		for (uint32_t i = 0; i < p_count; i++) {
+			if (unlikely(allocs_available == 0)) {
+				_add_page();
+			}
+			allocs_available--;
+			r_mem[i] = available_pool[allocs_available >> page_shift][allocs_available & page_mask];
+		}
+		if (thread_safe) {
+			spin_lock.unlock();
+		}
+	}
+
+	void free_batch(T *const *p_mem, uint32_t p_count) {
+		if (thread_safe) {
+			spin_lock.lock();
+		}
+		for (uint32_t i = 0; i < p_count; i++) {
+			available_pool[allocs_available >> page_shift][allocs_available & page_mask] = p_mem[i];
+			allocs_available++;
+		}
+		if (thread_safe) {
+			spin_lock.unlock();
+		}
+	}
+
 	template <typename... Args>
 	T *new_allocation(Args &&...p_args) { return alloc(p_args...); }
 	void delete_allocation(T *p_mem) { free(p_mem); }
@@ -0,0 +1,340 @@
+/**************************************************************************/
+/*  persistent_hash_map.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef PERSISTENT_HASH_MAP_H
+#define PERSISTENT_HASH_MAP_H
+
+#include "core/templates/hashfuncs.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+/**
+ * A hash map with structural sharing, stored as a hash array mapped trie (HAMT).
+ *
+ * Each level of the trie consumes 5 bits of the hash. Copying a PersistentHashMap
+ * is O(1): both copies share the same nodes, and writing to one of them only
+ * duplicates the nodes on the path to the modified key (O(log32 n)).
+ *
+ * The trie itself is unordered, but every entry remembers when its key was first
+ * inserted so get_entries() can return them in insertion order, like HashMap.
+ *
+ * Nodes are reference counted atomically, so copies can be handed to other
+ * threads. A single PersistentHashMap instance must not be written to and read
+ * from different threads at the same time.
+ */
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class PersistentHashMap {
+public:
+	struct Entry {
+		TKey key;
+		TValue value;
+		uint32_t hash = 0;
+		uint64_t order = 0;
+	};
+
+private:
+	static constexpr uint32_t BITS = 5;
+	static constexpr uint32_t MASK = (1 << BITS) - 1;
+	// Past this depth all the hash bits are used, remaining entries are stored unsorted.
+	static constexpr uint32_t MAX_SHIFT = 32;
+
+	struct Node {
+		SafeRefCount refcount;
+		// Bit i is set when slot i holds an entry (datamap) or a child node (nodemap).
+		uint32_t datamap = 0;
+		uint32_t nodemap = 0;
+		LocalVector<Entry> entries;
+		LocalVector<Node *> children;
+
+		Node() { refcount.init(); }
+	};
+
+	struct EntryOrder {
+		_FORCE_INLINE_ bool operator()(const Entry *p_a, const Entry *p_b) const { return p_a->order < p_b->order; }
+	};
+
+	Node *root = nullptr;
+	uint32_t num_elements = 0;
+	uint64_t next_order = 0;
+
+	static _FORCE_INLINE_ uint32_t _popcount(uint32_t p_bits) {
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_popcount(p_bits);
+#else
+		p_bits = p_bits - ((p_bits >> 1) & 0x55555555);
+		p_bits = (p_bits & 0x33333333) + ((p_bits >> 2) & 0x33333333);
+		return (((p_bits + (p_bits >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+#endif
+	}
+
+	static void _unref(Node *p_node) {
+		if (!p_node || !p_node->refcount.unref()) {
+			return;
+		}
+		for (Node *child : p_node->children) {
+			_unref(child);
+		}
+		memdelete(p_node);
+	}
+
+	// Makes sure the node in p_slot isn't shared with another map, copying it if needed.
+	static void _make_unique(Node *&p_slot) {
+		if (p_slot->refcount.get() == 1) {
+			return;
+		}
+		Node *copy = memnew(Node);
+		copy->datamap = p_slot->datamap;
+		copy->nodemap = p_slot->nodemap;
+		copy->entries = p_slot->entries;
+		copy->children = p_slot->children;
+		for (Node *child : copy->children) {
+			child->refcount.ref();
+		}
+		// The map it was shared with may have released it since the check, so it can reach zero here.
+		_unref(p_slot);
+		p_slot = copy;
+	}
+
+	const Entry *_lookup(const TKey &p_key, uint32_t p_hash) const {
+		const Node *node = root;
+		uint32_t shift = 0;
+		while (node) {
+			if (shift >= MAX_SHIFT) {
+				for (const Entry &entry : node->entries) {
+					if (entry.hash == p_hash && Comparator::compare(entry.key, p_key)) {
+						return &entry;
+					}
+				}
+				return nullptr;
+			}
+
+			const uint32_t bit = 1u << ((p_hash >> shift) & MASK);
+			if (node->datamap & bit) {
+				const Entry &entry = node->entries[_popcount(node->datamap & (bit - 1))];
+				return entry.hash == p_hash && Comparator::compare(entry.key, p_key) ? &entry : nullptr;
+			}
+			if (!(node->nodemap & bit)) {
+				return nullptr;
+			}
+			node = node->children[_popcount(node->nodemap & (bit - 1))];
+			shift += BITS;
+		}
+		return nullptr;
+	}
+
+	// Stores p_entry below p_slot, returns false if it replaced the value of an existing key.
+	static bool _insert(Node *&p_slot, uint32_t p_shift, const Entry &p_entry) {
+		if (!p_slot) {
+			p_slot = memnew(Node);
+		} else {
+			_make_unique(p_slot);
+		}
+		Node *node = p_slot;
+
+		if (p_shift >= MAX_SHIFT) {
+			for (Entry &entry : node->entries) {
+				if (entry.hash == p_entry.hash && Comparator::compare(entry.key, p_entry.key)) {
+					entry.value = p_entry.value;
+					return false;
+				}
+			}
+			node->entries.push_back(p_entry);
+			return true;
+		}
+
+		const uint32_t bit = 1u << ((p_entry.hash >> p_shift) & MASK);
+		if (node->nodemap & bit) {
+			return _insert(node->children[_popcount(node->nodemap & (bit - 1))], p_shift + BITS, p_entry);
+		}
+
+		const uint32_t entry_index = _popcount(node->datamap & (bit - 1));
+		if (!(node->datamap & bit)) {
+			node->entries.insert(entry_index, p_entry);
+			node->datamap |= bit;
+			return true;
+		}
+
+		Entry &existing = node->entries[entry_index];
+		if (existing.hash == p_entry.hash && Comparator::compare(existing.key, p_entry.key)) {
+			existing.value = p_entry.value;
+			return false;
+		}
+
+		// Two keys share this slot, push both one level down.
+		Node *child = nullptr;
+		_insert(child, p_shift + BITS, existing);
+		_insert(child, p_shift + BITS, p_entry);
+		node->entries.remove_at(entry_index);
+		node->datamap &= ~bit;
+		node->children.insert(_popcount(node->nodemap & (bit - 1)), child);
+		node->nodemap |= bit;
+		return true;
+	}
+
+	// Removes p_key, which must be stored below p_slot.
+	static void _erase(Node *&p_slot, uint32_t p_shift, const TKey &p_key, uint32_t p_hash) {
+		_make_unique(p_slot);
+		Node *node = p_slot;
+
+		if (p_shift >= MAX_SHIFT) {
+			for (uint32_t i = 0; i < node->entries.size(); i++) {
+				if (node->entries[i].hash == p_hash && Comparator::compare(node->entries[i].key, p_key)) {
+					node->entries.remove_at(i);
+					return;
+				}
+			}
+			return;
+		}
+
+		const uint32_t bit = 1u << ((p_hash >> p_shift) & MASK);
+		if (node->datamap & bit) {
+			node->entries.remove_at(_popcount(node->datamap & (bit - 1)));
+			node->datamap &= ~bit;
+			return;
+		}
+
+		const uint32_t child_index = _popcount(node->nodemap & (bit - 1));
+		Node *&child = node->children[child_index];
+		_erase(child, p_shift + BITS, p_key, p_hash);
+
+		// Keep the trie canonical, a child left with a single entry is merged back into this node.
+		if (child->children.is_empty() && child->entries.size() <= 1) {
+			if (child->entries.size() == 1) {
+				node->entries.insert(_popcount(node->datamap & (bit - 1)), child->entries[0]);
+				node->datamap |= bit;
+			}
+			_unref(child);
+			node->children.remove_at(child_index);
+			node->nodemap &= ~bit;
+		}
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+	_FORCE_INLINE_ bool is_empty() const { return num_elements == 0; }
+
+	const TValue *getptr(const TKey &p_key) const {
+		const Entry *entry = _lookup(p_key, Hasher::hash(p_key));
+		return entry ? &entry->value : nullptr;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		const TValue *value = getptr(p_key);
+		CRASH_COND_MSG(!value, "PersistentHashMap key not found.");
+		return *value;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		return getptr(p_key) != nullptr;
+	}
+
+	void insert(const TKey &p_key, const TValue &p_value) {
+		Entry entry;
+		entry.key = p_key;
+		entry.value = p_value;
+		entry.hash = Hasher::hash(p_key);
+		entry.order = next_order;
+		if (_insert(root, 0, entry)) {
+			num_elements++;
+			next_order++;
+		}
+	}
+
+	bool erase(const TKey &p_key) {
+		const uint32_t hash = Hasher::hash(p_key);
+		if (!_lookup(p_key, hash)) {
+			return false;
+		}
+		_erase(root, 0, p_key, hash);
+		num_elements--;
+		if (num_elements == 0) {
+			clear();
+		}
+		return true;
+	}
+
+	void clear() {
+		_unref(root);
+		root = nullptr;
+		num_elements = 0;
+		next_order = 0;
+	}
+
+	// Returns all entries, in the order their keys were first inserted.
+	void get_entries(LocalVector<const Entry *> &r_entries) const {
+		r_entries.clear();
+		r_entries.reserve(num_elements);
+		LocalVector<const Node *> stack;
+		if (root) {
+			stack.push_back(root);
+		}
+		while (!stack.is_empty()) {
+			const Node *node = stack[stack.size() - 1];
+			stack.resize(stack.size() - 1);
+			for (const Entry &entry : node->entries) {
+				r_entries.push_back(&entry);
+			}
+			for (const Node *child : node->children) {
+				stack.push_back(child);
+			}
+		}
+		r_entries.template sort_custom<EntryOrder>();
+	}
+
+	void operator=(const PersistentHashMap &p_other) {
+		if (this == &p_other) {
+			return;
+		}
+		if (p_other.root) {
+			p_other.root->refcount.ref();
+		}
+		_unref(root);
+		root = p_other.root;
+		num_elements = p_other.num_elements;
+		next_order = p_other.next_order;
+	}
+
+	PersistentHashMap(const PersistentHashMap &p_other) :
+			root(p_other.root), num_elements(p_other.num_elements), next_order(p_other.next_order) {
+		if (root) {
+			root->refcount.ref();
+		}
+	}
+
+	PersistentHashMap() {}
+
+	~PersistentHashMap() {
+		_unref(root);
+	}
+};
+
+#endif // PERSISTENT_HASH_MAP_H
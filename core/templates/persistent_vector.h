@@ -0,0 +1,248 @@
+/**************************************************************************/
+/*  persistent_vector.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef PERSISTENT_VECTOR_H
+#define PERSISTENT_VECTOR_H
+
+#include "core/error/error_macros.h"
+#include "core/os/memory.h"
+#include "core/templates/safe_refcount.h"
+
+/**
+ * A vector with structural sharing, stored as a 32-way trie.
+ *
+ * Copying a PersistentVector is O(1): both copies share the same nodes. Writing
+ * to one of them only duplicates the nodes on the path to the modified element
+ * (O(log32 n)), the rest of the trie stays shared. This makes it cheap to keep
+ * many snapshots of a large, slowly changing vector.
+ *
+ * Nodes are reference counted atomically, so copies can be handed to other
+ * threads. A single PersistentVector instance must not be written to and read
+ * from different threads at the same time.
+ */
+template <typename T>
+class PersistentVector {
+	static constexpr uint32_t BITS = 5;
+	static constexpr uint32_t WIDTH = 1 << BITS;
+	static constexpr uint32_t MASK = WIDTH - 1;
+
+	struct Node {
+		SafeRefCount refcount;
+		Node() { refcount.init(); }
+	};
+
+	struct Leaf : public Node {
+		T values[WIDTH];
+	};
+
+	struct Inner : public Node {
+		Node *children[WIDTH] = {};
+	};
+
+	Node *root = nullptr;
+	// Bits of the index consumed above the leaves, 0 when the root is a leaf.
+	uint32_t shift = 0;
+	uint32_t count = 0;
+
+	static void _unref(Node *p_node, uint32_t p_shift) {
+		if (!p_node || !p_node->refcount.unref()) {
+			return;
+		}
+		if (p_shift == 0) {
+			memdelete(static_cast<Leaf *>(p_node));
+			return;
+		}
+		Inner *inner = static_cast<Inner *>(p_node);
+		for (uint32_t i = 0; i < WIDTH; i++) {
+			_unref(inner->children[i], p_shift - BITS);
+		}
+		memdelete(inner);
+	}
+
+	// Makes sure the node in p_slot isn't shared with another vector, copying it if needed.
+	static void _make_unique(Node *&p_slot, uint32_t p_shift) {
+		if (!p_slot) {
+			if (p_shift == 0) {
+				p_slot = memnew(Leaf);
+			} else {
+				p_slot = memnew(Inner);
+			}
+			return;
+		}
+		if (p_slot->refcount.get() == 1) {
+			return;
+		}
+
+		Node *copy;
+		if (p_shift == 0) {
+			Leaf *leaf = memnew(Leaf);
+			const Leaf *src = static_cast<const Leaf *>(p_slot);
+			for (uint32_t i = 0; i < WIDTH; i++) {
+				leaf->values[i] = src->values[i];
+			}
+			copy = leaf;
+		} else {
+			Inner *inner = memnew(Inner);
+			const Inner *src = static_cast<const Inner *>(p_slot);
+			for (uint32_t i = 0; i < WIDTH; i++) {
+				inner->children[i] = src->children[i];
+				if (inner->children[i]) {
+					inner->children[i]->refcount.ref();
+				}
+			}
+			copy = inner;
+		}
+		// The vector it was shared with may have released it since the check, so it can reach zero here.
+		_unref(p_slot, p_shift);
+		p_slot = copy;
+	}
+
+	// Returns the value at p_index for writing, copying the nodes on its path that are shared.
+	T &_get_writable(uint32_t p_index) {
+		_make_unique(root, shift);
+		Node *node = root;
+		for (uint32_t s = shift; s > 0; s -= BITS) {
+			Node *&child = static_cast<Inner *>(node)->children[(p_index >> s) & MASK];
+			_make_unique(child, s - BITS);
+			node = child;
+		}
+		return static_cast<Leaf *>(node)->values[p_index & MASK];
+	}
+
+	// Drops the subtree holding p_index if it's the first element it stores.
+	static void _trim(Node *&p_slot, uint32_t p_shift, uint32_t p_index) {
+		if (!p_slot) {
+			return;
+		}
+		if ((p_index & ((WIDTH << p_shift) - 1)) == 0) {
+			_unref(p_slot, p_shift);
+			p_slot = nullptr;
+			return;
+		}
+		// Only reached for inner nodes, p_index is always the first element of its leaf.
+		_make_unique(p_slot, p_shift);
+		_trim(static_cast<Inner *>(p_slot)->children[(p_index >> p_shift) & MASK], p_shift - BITS, p_index);
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t size() const { return count; }
+	_FORCE_INLINE_ bool is_empty() const { return count == 0; }
+
+	const T &get(uint32_t p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		const Node *node = root;
+		for (uint32_t s = shift; s > 0; s -= BITS) {
+			node = static_cast<const Inner *>(node)->children[(p_index >> s) & MASK];
+		}
+		return static_cast<const Leaf *>(node)->values[p_index & MASK];
+	}
+
+	_FORCE_INLINE_ const T &operator[](uint32_t p_index) const {
+		return get(p_index);
+	}
+
+	void set(uint32_t p_index, const T &p_value) {
+		ERR_FAIL_UNSIGNED_INDEX(p_index, count);
+		_get_writable(p_index) = p_value;
+	}
+
+	void push_back(const T &p_value) {
+		ERR_FAIL_COND_MSG(count == UINT32_MAX, "PersistentVector is full.");
+		if (root && (count >> BITS) >= (1u << shift)) {
+			// The trie is full, grow it by one level.
+			Inner *new_root = memnew(Inner);
+			new_root->children[0] = root;
+			root = new_root;
+			shift += BITS;
+		}
+		count++;
+		_get_writable(count - 1) = p_value;
+	}
+
+	void pop_back() {
+		ERR_FAIL_COND(count == 0);
+		count--;
+		if (count == 0) {
+			clear();
+			return;
+		}
+
+		// Release the value, or the whole leaf if it was the only one left in it.
+		if ((count & MASK) == 0) {
+			_trim(root, shift, count);
+		} else {
+			_get_writable(count) = T();
+		}
+
+		// Collapse the root while only its first child is in use.
+		while (shift > 0 && (count - 1) < (WIDTH << (shift - BITS))) {
+			Inner *old_root = static_cast<Inner *>(root);
+			root = old_root->children[0];
+			root->refcount.ref();
+			_unref(old_root, shift);
+			shift -= BITS;
+		}
+	}
+
+	void clear() {
+		_unref(root, shift);
+		root = nullptr;
+		shift = 0;
+		count = 0;
+	}
+
+	void operator=(const PersistentVector &p_other) {
+		if (this == &p_other) {
+			return;
+		}
+		if (p_other.root) {
+			p_other.root->refcount.ref();
+		}
+		_unref(root, shift);
+		root = p_other.root;
+		shift = p_other.shift;
+		count = p_other.count;
+	}
+
+	PersistentVector(const PersistentVector &p_other) :
+			root(p_other.root), shift(p_other.shift), count(p_other.count) {
+		if (root) {
+			root->refcount.ref();
+		}
+	}
+
+	PersistentVector() {}
+
+	~PersistentVector() {
+		_unref(root, shift);
+	}
+};
+
+#endif // PERSISTENT_VECTOR_H
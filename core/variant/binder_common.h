@@ -320,24 +320,48 @@ void call_with_variant_argsc_helper(T *p_instance, void (T::*p_method)(P...) con
 	(void)(p_args); //avoid warning
 }
 
-template <typename T, typename... P, size_t... Is>
+// Holds one argument of a typed ptrcall, see MethodBind::ptrcall_typed().
+// Arguments already stored the way ptrcall expects them are referenced in place,
+// the rest (e.g. int32_t, which ptrcall passes as int64_t) are encoded into a local.
+template <typename T, typename = void>
+struct PtrcallArgument {
+	typename PtrToArg<T>::EncodeT encoded;
+
+	_FORCE_INLINE_ const void *ptr() const { return &encoded; }
+
+	_FORCE_INLINE_ PtrcallArgument(const T &p_arg) {
+		PtrToArg<T>::encode(p_arg, &encoded);
+	}
+};
+
+template <typename T>
+struct PtrcallArgument<T, std::enable_if_t<std::is_same_v<typename PtrToArg<T>::EncodeT, T>>> {
+	const T &arg;
+
+	_FORCE_INLINE_ const void *ptr() const { return &arg; }
+
+	_FORCE_INLINE_ PtrcallArgument(const T &p_arg) :
+			arg(p_arg) {}
+};
+
+template <template <typename> class C, typename T, typename... P, size_t... Is>
 void call_with_ptr_args_helper(T *p_instance, void (T::*p_method)(P...), const void **p_args, IndexSequence<Is...>) {
-	(p_instance->*p_method)(PtrToArg<P>::convert(p_args[Is])...);
+	(p_instance->*p_method)(C<P>::convert(p_args[Is])...);
 }
 
-template <typename T, typename... P, size_t... Is>
+template <template <typename> class C, typename T, typename... P, size_t... Is>
 void call_with_ptr_argsc_helper(T *p_instance, void (T::*p_method)(P...) const, const void **p_args, IndexSequence<Is...>) {
-	(p_instance->*p_method)(PtrToArg<P>::convert(p_args[Is])...);
+	(p_instance->*p_method)(C<P>::convert(p_args[Is])...);
 }
 
-template <typename T, typename R, typename... P, size_t... Is>
+template <template <typename> class C, typename T, typename R, typename... P, size_t... Is>
 void call_with_ptr_args_ret_helper(T *p_instance, R (T::*p_method)(P...), const void **p_args, void *r_ret, IndexSequence<Is...>) {
-	PtrToArg<R>::encode((p_instance->*p_method)(PtrToArg<P>::convert(p_args[Is])...), r_ret);
+	PtrToArg<R>::encode((p_instance->*p_method)(C<P>::convert(p_args[Is])...), r_ret);
 }
 
-template <typename T, typename R, typename... P, size_t... Is>
+template <template <typename> class C, typename T, typename R, typename... P, size_t... Is>
 void call_with_ptr_args_retc_helper(T *p_instance, R (T::*p_method)(P...) const, const void **p_args, void *r_ret, IndexSequence<Is...>) {
-	PtrToArg<R>::encode((p_instance->*p_method)(PtrToArg<P>::convert(p_args[Is])...), r_ret);
+	PtrToArg<R>::encode((p_instance->*p_method)(C<P>::convert(p_args[Is])...), r_ret);
 }
 
 template <typename T, typename... P, size_t... Is>
@@ -570,22 +594,42 @@ void call_with_variant_args_retc_dv(T *p_instance, R (T::*p_method)(P...) const,
 
 template <typename T, typename... P>
 void call_with_ptr_args(T *p_instance, void (T::*p_method)(P...), const void **p_args) {
-	call_with_ptr_args_helper<T, P...>(p_instance, p_method, p_args, BuildIndexSequence<sizeof...(P)>{});
+	call_with_ptr_args_helper<PtrToArg, T, P...>(p_instance, p_method, p_args, BuildIndexSequence<sizeof...(P)>{});
 }
 
 template <typename T, typename... P>
 void call_with_ptr_argsc(T *p_instance, void (T::*p_method)(P...) const, const void **p_args) {
-	call_with_ptr_argsc_helper<T, P...>(p_instance, p_method, p_args, BuildIndexSequence<sizeof...(P)>{});
+	call_with_ptr_argsc_helper<PtrToArg, T, P...>(p_instance, p_method, p_args, BuildIndexSequence<sizeof...(P)>{});
 }
 
 template <typename T, typename R, typename... P>
 void call_with_ptr_args_ret(T *p_instance, R (T::*p_method)(P...), const void **p_args, void *r_ret) {
-	call_with_ptr_args_ret_helper<T, R, P...>(p_instance, p_method, p_args, r_ret, BuildIndexSequence<sizeof...(P)>{});
+	call_with_ptr_args_ret_helper<PtrToArg, T, R, P...>(p_instance, p_method, p_args, r_ret, BuildIndexSequence<sizeof...(P)>{});
 }
 
 template <typename T, typename R, typename... P>
 void call_with_ptr_args_retc(T *p_instance, R (T::*p_method)(P...) const, const void **p_args, void *r_ret) {
-	call_with_ptr_args_retc_helper<T, R, P...>(p_instance, p_method, p_args, r_ret, BuildIndexSequence<sizeof...(P)>{});
+	call_with_ptr_args_retc_helper<PtrToArg, T, R, P...>(p_instance, p_method, p_args, r_ret, BuildIndexSequence<sizeof...(P)>{});
+}
+
+template <typename T, typename... P>
+void call_with_ptr_args_borrowed(T *p_instance, void (T::*p_method)(P...), const void **p_args) {
+	call_with_ptr_args_helper<PtrToArgBorrowed, T, P...>(p_instance, p_method, p_args, BuildIndexSequence<sizeof...(P)>{});
+}
+
+template <typename T, typename... P>
+void call_with_ptr_argsc_borrowed(T *p_instance, void (T::*p_method)(P...) const, const void **p_args) {
+	call_with_ptr_argsc_helper<PtrToArgBorrowed, T, P...>(p_instance, p_method, p_args, BuildIndexSequence<sizeof...(P)>{});
+}
+
+template <typename T, typename R, typename... P>
+void call_with_ptr_args_ret_borrowed(T *p_instance, R (T::*p_method)(P...), const void **p_args, void *r_ret) {
+	call_with_ptr_args_ret_helper<PtrToArgBorrowed, T, R, P...>(p_instance, p_method, p_args, r_ret, BuildIndexSequence<sizeof...(P)>{});
+}
+
+template <typename T, typename R, typename... P>
+void call_with_ptr_args_retc_borrowed(T *p_instance, R (T::*p_method)(P...) const, const void **p_args, void *r_ret) {
+	call_with_ptr_args_retc_helper<PtrToArgBorrowed, T, R, P...>(p_instance, p_method, p_args, r_ret, BuildIndexSequence<sizeof...(P)>{});
 }
 
 template <typename T, typename... P>
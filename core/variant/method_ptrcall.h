@@ -38,6 +38,12 @@
 template <typename T>
 struct PtrToArg {};
 
+// Conversion used by MethodBind::ptrcall_borrowed(), whose caller keeps every argument
+// alive and unchanged for the whole call. Types that can then be read in place without
+// taking ownership specialize this, everything else converts like PtrToArg.
+template <typename T>
+struct PtrToArgBorrowed : public PtrToArg<T> {};
+
 #define MAKE_PTRARG(m_type)                                              \
 	template <>                                                          \
 	struct PtrToArg<m_type> {                                            \
@@ -0,0 +1,77 @@
+/**************************************************************************/
+/*  persistent_array.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "persistent_array.h"
+
+void PersistentArray::set(int p_idx, const Variant &p_value) {
+	ERR_FAIL_INDEX(p_idx, size());
+	Variant value = p_value;
+	ERR_FAIL_COND(!typed.validate(value, "set"));
+	values.set(p_idx, value);
+}
+
+void PersistentArray::push_back(const Variant &p_value) {
+	Variant value = p_value;
+	ERR_FAIL_COND(!typed.validate(value, "push_back"));
+	values.push_back(value);
+}
+
+void PersistentArray::pop_back() {
+	ERR_FAIL_COND(values.is_empty());
+	values.pop_back();
+}
+
+void PersistentArray::clear() {
+	values.clear();
+}
+
+Array PersistentArray::to_array() const {
+	Array array;
+	if (typed.type != Variant::NIL) {
+		array.set_typed(typed.type, typed.class_name, typed.script);
+	}
+	array.resize(values.size());
+	for (uint32_t i = 0; i < values.size(); i++) {
+		array.set(i, values[i]);
+	}
+	return array;
+}
+
+PersistentArray::PersistentArray(const Array &p_from) {
+	if (p_from.is_typed()) {
+		typed.type = Variant::Type(p_from.get_typed_builtin());
+		typed.class_name = p_from.get_typed_class_name();
+		typed.script = p_from.get_typed_script();
+		typed.where = "TypedArray";
+	}
+	for (int i = 0; i < p_from.size(); i++) {
+		values.push_back(p_from[i]);
+	}
+}
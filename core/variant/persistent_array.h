@@ -0,0 +1,72 @@
+/**************************************************************************/
+/*  persistent_array.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef PERSISTENT_ARRAY_H
+#define PERSISTENT_ARRAY_H
+
+#include "core/templates/persistent_vector.h"
+#include "core/variant/array.h"
+#include "core/variant/container_type_validate.h"
+#include "core/variant/variant.h"
+
+// Value-semantic Array snapshot with structural sharing.
+//
+// Copying is O(1) and modifying a copy is O(log n), only the modified path of the
+// underlying trie gets duplicated. Keeping one snapshot per frame of a large array
+// costs memory proportional to what changed, instead of duplicating it every time.
+//
+// Values are captured shallowly, like Array::duplicate(false): nested arrays,
+// dictionaries and objects are shared with the source.
+//
+// Only meant for engine code for now, it's neither a Variant type nor bound to scripts.
+class PersistentArray {
+	PersistentVector<Variant> values;
+	// The type of the source array, written values must match it like in the array itself.
+	ContainerTypeValidate typed;
+
+public:
+	_FORCE_INLINE_ int size() const { return values.size(); }
+	_FORCE_INLINE_ bool is_empty() const { return values.is_empty(); }
+
+	_FORCE_INLINE_ const Variant &get(int p_idx) const { return values.get(p_idx); }
+	_FORCE_INLINE_ const Variant &operator[](int p_idx) const { return values.get(p_idx); }
+
+	void set(int p_idx, const Variant &p_value);
+	void push_back(const Variant &p_value);
+	void pop_back();
+	void clear();
+
+	Array to_array() const;
+
+	PersistentArray(const Array &p_from);
+	PersistentArray() {}
+};
+
+#endif // PERSISTENT_ARRAY_H
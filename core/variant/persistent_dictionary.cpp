@@ -0,0 +1,64 @@
+/**************************************************************************/
+/*  persistent_dictionary.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "persistent_dictionary.h"
+
+Variant PersistentDictionary::get(const Variant &p_key, const Variant &p_default) const {
+	const Variant *value = map.getptr(p_key);
+	return value ? *value : p_default;
+}
+
+void PersistentDictionary::set(const Variant &p_key, const Variant &p_value) {
+	map.insert(p_key, p_value);
+}
+
+bool PersistentDictionary::erase(const Variant &p_key) {
+	return map.erase(p_key);
+}
+
+void PersistentDictionary::clear() {
+	map.clear();
+}
+
+Dictionary PersistentDictionary::to_dictionary() const {
+	LocalVector<const Map::Entry *> entries;
+	map.get_entries(entries);
+	Dictionary dictionary;
+	for (const Map::Entry *entry : entries) {
+		dictionary[entry->key] = entry->value;
+	}
+	return dictionary;
+}
+
+PersistentDictionary::PersistentDictionary(const Dictionary &p_from) {
+	for (const Variant *key = p_from.next(); key; key = p_from.next(key)) {
+		map.insert(*key, p_from[*key]);
+	}
+}
@@ -0,0 +1,70 @@
+/**************************************************************************/
+/*  persistent_dictionary.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef PERSISTENT_DICTIONARY_H
+#define PERSISTENT_DICTIONARY_H
+
+#include "core/templates/persistent_hash_map.h"
+#include "core/variant/dictionary.h"
+#include "core/variant/variant.h"
+
+// Value-semantic Dictionary snapshot with structural sharing.
+//
+// Copying is O(1) and modifying a copy is O(log n), only the modified path of the
+// underlying trie gets duplicated. Converting back with to_dictionary() keeps the
+// insertion order of the keys.
+//
+// Values are captured shallowly, like Dictionary::duplicate(false): nested arrays,
+// dictionaries and objects are shared with the source.
+//
+// Like PersistentArray, this is engine-side only and not exposed to scripts.
+class PersistentDictionary {
+	typedef PersistentHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> Map;
+	Map map;
+
+public:
+	_FORCE_INLINE_ int size() const { return map.size(); }
+	_FORCE_INLINE_ bool is_empty() const { return map.is_empty(); }
+
+	_FORCE_INLINE_ const Variant *getptr(const Variant &p_key) const { return map.getptr(p_key); }
+	_FORCE_INLINE_ bool has(const Variant &p_key) const { return map.has(p_key); }
+	Variant get(const Variant &p_key, const Variant &p_default) const;
+
+	void set(const Variant &p_key, const Variant &p_value);
+	bool erase(const Variant &p_key);
+	void clear();
+
+	Dictionary to_dictionary() const;
+
+	PersistentDictionary(const Dictionary &p_from);
+	PersistentDictionary() {}
+};
+
+#endif // PERSISTENT_DICTIONARY_H
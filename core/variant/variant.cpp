@@ -38,9 +38,9 @@
 #include "core/string/print_string.h"
 #include "core/variant/variant_parser.h"
 
-PagedAllocator<Variant::Pools::BucketSmall, true> Variant::Pools::_bucket_small;
-PagedAllocator<Variant::Pools::BucketMedium, true> Variant::Pools::_bucket_medium;
-PagedAllocator<Variant::Pools::BucketLarge, true> Variant::Pools::_bucket_large;
+Variant::Pools::BucketAllocator<Variant::Pools::BucketSmall> Variant::Pools::_bucket_small;
+Variant::Pools::BucketAllocator<Variant::Pools::BucketMedium> Variant::Pools::_bucket_medium;
+Variant::Pools::BucketAllocator<Variant::Pools::BucketLarge> Variant::Pools::_bucket_large;
 
 String Variant::get_type_name(Variant::Type p_type) {
 	switch (p_type) {
@@ -158,9 +158,83 @@ private:
 			Projection _projection;
 		};
 
-		static PagedAllocator<BucketSmall, true> _bucket_small;
-		static PagedAllocator<BucketMedium, true> _bucket_medium;
-		static PagedAllocator<BucketLarge, true> _bucket_large;
+		// Thread safe allocator with a small per-thread cache of free elements in front,
+		// so most allocations and frees don't touch the shared pool's lock. Elements can
+		// be freed from any thread: a cache gives half of its elements back to the pool
+		// when it fills up, and all of them when its thread exits.
+		// There must be a single BucketAllocator per bucket type.
+		template <typename T>
+		class BucketAllocator {
+			static constexpr uint32_t CACHE_SIZE = 64;
+			static constexpr uint32_t CACHE_BATCH = CACHE_SIZE / 2;
+
+			struct ThreadCache {
+				T *elements[CACHE_SIZE] = {};
+				uint32_t count = 0;
+				uint32_t limit = CACHE_SIZE; // Set to zero once destroyed, to route everything through the slow paths.
+
+				~ThreadCache() {
+					if (count > 0) {
+						singleton->pool.free_batch(elements, count);
+					}
+					count = 0;
+					limit = 0;
+				}
+			};
+
+			static inline BucketAllocator *singleton = nullptr;
+			static inline thread_local ThreadCache thread_cache;
+
+			PagedAllocator<T, true> pool;
+
+			T *_alloc_slow(ThreadCache &p_cache) {
+				if (unlikely(p_cache.limit == 0)) {
+					// Thread is exiting, bypass the cache.
+					return pool.alloc();
+				}
+				pool.alloc_batch(p_cache.elements, CACHE_BATCH);
+				p_cache.count = CACHE_BATCH - 1;
+				return memnew_placement(p_cache.elements[CACHE_BATCH - 1], T);
+			}
+
+			void _free_slow(ThreadCache &p_cache, T *p_mem) {
+				if (unlikely(p_cache.limit == 0)) {
+					pool.free(p_mem);
+					return;
+				}
+				p_mem->~T();
+				p_cache.count -= CACHE_BATCH;
+				pool.free_batch(p_cache.elements + p_cache.count, CACHE_BATCH);
+				p_cache.elements[p_cache.count++] = p_mem;
+			}
+
+		public:
+			_FORCE_INLINE_ T *alloc() {
+				ThreadCache &cache = thread_cache;
+				if (unlikely(cache.count == 0)) {
+					return _alloc_slow(cache);
+				}
+				return memnew_placement(cache.elements[--cache.count], T);
+			}
+
+			_FORCE_INLINE_ void free(T *p_mem) {
+				ThreadCache &cache = thread_cache;
+				if (unlikely(cache.count == cache.limit)) {
+					_free_slow(cache, p_mem);
+					return;
+				}
+				p_mem->~T();
+				cache.elements[cache.count++] = p_mem;
+			}
+
+			BucketAllocator() {
+				singleton = this;
+			}
+		};
+
+		static BucketAllocator<BucketSmall> _bucket_small;
+		static BucketAllocator<BucketMedium> _bucket_medium;
+		static BucketAllocator<BucketLarge> _bucket_large;
 	};
 
 	friend struct _VariantCall;
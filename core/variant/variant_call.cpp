@@ -35,6 +35,7 @@
 #include "core/io/compression.h"
 #include "core/io/marshalls.h"
 #include "core/object/class_db.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
@@ -1018,6 +1019,286 @@ struct _VariantCall {
 		return len;
 	}
 
+	// Bulk math on packed arrays. The loops run over raw pointers without any
+	// per-element dispatch so the compiler can vectorize them, and very large
+	// arrays are split into chunks processed on the WorkerThreadPool.
+	// Reductions always run on the calling thread to keep their results stable.
+
+	static constexpr int PACKED_BULK_CHUNK_SIZE = 1 << 16;
+	static constexpr int PACKED_BULK_PARALLEL_MIN_SIZE = 1 << 19;
+	static constexpr int PACKED_BULK_LANES = 8;
+
+	template <typename F>
+	struct PackedBulkTask {
+		const F *func = nullptr;
+		int count = 0;
+
+		static void process_chunk(void *p_userdata, uint32_t p_chunk) {
+			const PackedBulkTask *task = static_cast<const PackedBulkTask *>(p_userdata);
+			const int from = p_chunk * PACKED_BULK_CHUNK_SIZE;
+			(*task->func)(from, MIN(from + PACKED_BULK_CHUNK_SIZE, task->count));
+		}
+	};
+
+	// Calls p_func(from, to) over [0, p_count), in parallel if the range is large enough.
+	template <typename F>
+	static void _packed_bulk_for(int p_count, const F &p_func) {
+		WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+		if (p_count < PACKED_BULK_PARALLEL_MIN_SIZE || !pool || pool->get_thread_count() < 2 || WorkerThreadPool::get_thread_index() != -1) {
+			p_func(0, p_count);
+			return;
+		}
+
+		PackedBulkTask<F> task;
+		task.func = &p_func;
+		task.count = p_count;
+		const int chunks = (p_count + PACKED_BULK_CHUNK_SIZE - 1) / PACKED_BULK_CHUNK_SIZE;
+		WorkerThreadPool::GroupID group = pool->add_native_group_task(&PackedBulkTask<F>::process_chunk, &task, chunks, -1, true);
+		pool->wait_for_group_task_completion(group);
+	}
+
+	template <typename T>
+	static void func_PackedFloatArray_add_scalar(Vector<T> *p_instance, double p_value) {
+		T *w = p_instance->ptrw();
+		const T value = p_value;
+		_packed_bulk_for(p_instance->size(), [w, value](int p_begin, int p_end) {
+			for (int i = p_begin; i < p_end; i++) {
+				w[i] += value;
+			}
+		});
+	}
+
+	template <typename T>
+	static void func_PackedFloatArray_multiply_scalar(Vector<T> *p_instance, double p_value) {
+		T *w = p_instance->ptrw();
+		const T value = p_value;
+		_packed_bulk_for(p_instance->size(), [w, value](int p_begin, int p_end) {
+			for (int i = p_begin; i < p_end; i++) {
+				w[i] *= value;
+			}
+		});
+	}
+
+	template <typename T>
+	static void func_PackedFloatArray_multiply_add_scalar(Vector<T> *p_instance, double p_multiplier, double p_addend) {
+		T *w = p_instance->ptrw();
+		const T multiplier = p_multiplier;
+		const T addend = p_addend;
+		_packed_bulk_for(p_instance->size(), [w, multiplier, addend](int p_begin, int p_end) {
+			for (int i = p_begin; i < p_end; i++) {
+				w[i] = w[i] * multiplier + addend;
+			}
+		});
+	}
+
+	template <typename T>
+	static void func_PackedFloatArray_add_array(Vector<T> *p_instance, const Vector<T> &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");
+		T *w = p_instance->ptrw();
+		const T *r = p_array.ptr();
+		_packed_bulk_for(p_instance->size(), [w, r](int p_begin, int p_end) {
+			for (int i = p_begin; i < p_end; i++) {
+				w[i] += r[i];
+			}
+		});
+	}
+
+	template <typename T>
+	static void func_PackedFloatArray_multiply_array(Vector<T> *p_instance, const Vector<T> &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");
+		T *w = p_instance->ptrw();
+		const T *r = p_array.ptr();
+		_packed_bulk_for(p_instance->size(), [w, r](int p_begin, int p_end) {
+			for (int i = p_begin; i < p_end; i++) {
+				w[i] *= r[i];
+			}
+		});
+	}
+
+	template <typename T>
+	static void func_PackedFloatArray_clamp(Vector<T> *p_instance, double p_min, double p_max) {
+		T *w = p_instance->ptrw();
+		const T min_value = p_min;
+		const T max_value = p_max;
+		_packed_bulk_for(p_instance->size(), [w, min_value, max_value](int p_begin, int p_end) {
+			for (int i = p_begin; i < p_end; i++) {
+				w[i] = CLAMP(w[i], min_value, max_value);
+			}
+		});
+	}
+
+	template <typename T>
+	static void func_PackedFloatArray_lerp(Vector<T> *p_instance, const Vector<T> &p_to, double p_weight) {
+		ERR_FAIL_COND_MSG(p_to.size() != p_instance->size(), "Both arrays must have the same size.");
+		T *w = p_instance->ptrw();
+		const T *r = p_to.ptr();
+		const T weight = p_weight;
+		_packed_bulk_for(p_instance->size(), [w, r, weight](int p_begin, int p_end) {
+			for (int i = p_begin; i < p_end; i++) {
+				w[i] += (r[i] - w[i]) * weight;
+			}
+		});
+	}
+
+	// Reductions keep one accumulator per lane so they can be vectorized without reassociating the math.
+
+	template <typename T>
+	static double func_PackedFloatArray_dot(Vector<T> *p_instance, const Vector<T> &p_array) {
+		ERR_FAIL_COND_V_MSG(p_array.size() != p_instance->size(), 0.0, "Both arrays must have the same size.");
+		const T *a = p_instance->ptr();
+		const T *b = p_array.ptr();
+		const int size = p_instance->size();
+		double lanes[PACKED_BULK_LANES] = {};
+		int i = 0;
+		for (; i + PACKED_BULK_LANES <= size; i += PACKED_BULK_LANES) {
+			for (int j = 0; j < PACKED_BULK_LANES; j++) {
+				lanes[j] += double(a[i + j]) * double(b[i + j]);
+			}
+		}
+		double result = 0.0;
+		for (; i < size; i++) {
+			result += double(a[i]) * double(b[i]);
+		}
+		for (int j = 0; j < PACKED_BULK_LANES; j++) {
+			result += lanes[j];
+		}
+		return result;
+	}
+
+	template <typename T>
+	static double func_PackedFloatArray_sum(Vector<T> *p_instance) {
+		const T *r = p_instance->ptr();
+		const int size = p_instance->size();
+		double lanes[PACKED_BULK_LANES] = {};
+		int i = 0;
+		for (; i + PACKED_BULK_LANES <= size; i += PACKED_BULK_LANES) {
+			for (int j = 0; j < PACKED_BULK_LANES; j++) {
+				lanes[j] += r[i + j];
+			}
+		}
+		double result = 0.0;
+		for (; i < size; i++) {
+			result += r[i];
+		}
+		for (int j = 0; j < PACKED_BULK_LANES; j++) {
+			result += lanes[j];
+		}
+		return result;
+	}
+
+	template <typename T>
+	static double func_PackedFloatArray_min(Vector<T> *p_instance) {
+		ERR_FAIL_COND_V_MSG(p_instance->is_empty(), 0.0, "Can't get the minimum of an empty array.");
+		const T *r = p_instance->ptr();
+		const int size = p_instance->size();
+		T lanes[PACKED_BULK_LANES];
+		for (int j = 0; j < PACKED_BULK_LANES; j++) {
+			lanes[j] = r[0];
+		}
+		int i = 0;
+		for (; i + PACKED_BULK_LANES <= size; i += PACKED_BULK_LANES) {
+			for (int j = 0; j < PACKED_BULK_LANES; j++) {
+				lanes[j] = r[i + j] < lanes[j] ? r[i + j] : lanes[j];
+			}
+		}
+		T result = r[0];
+		for (; i < size; i++) {
+			result = MIN(result, r[i]);
+		}
+		for (int j = 0; j < PACKED_BULK_LANES; j++) {
+			result = MIN(result, lanes[j]);
+		}
+		return result;
+	}
+
+	template <typename T>
+	static double func_PackedFloatArray_max(Vector<T> *p_instance) {
+		ERR_FAIL_COND_V_MSG(p_instance->is_empty(), 0.0, "Can't get the maximum of an empty array.");
+		const T *r = p_instance->ptr();
+		const int size = p_instance->size();
+		T lanes[PACKED_BULK_LANES];
+		for (int j = 0; j < PACKED_BULK_LANES; j++) {
+			lanes[j] = r[0];
+		}
+		int i = 0;
+		for (; i + PACKED_BULK_LANES <= size; i += PACKED_BULK_LANES) {
+			for (int j = 0; j < PACKED_BULK_LANES; j++) {
+				lanes[j] = r[i + j] > lanes[j] ? r[i + j] : lanes[j];
+			}
+		}
+		T result = r[0];
+		for (; i < size; i++) {
+			result = MAX(result, r[i]);
+		}
+		for (int j = 0; j < PACKED_BULK_LANES; j++) {
+			result = MAX(result, lanes[j]);
+		}
+		return result;
+	}
+
+	static void func_PackedVector3Array_add_array(PackedVector3Array *p_instance, const PackedVector3Array &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");
+		if (p_instance->is_empty()) {
+			return;
+		}
+		// Vector3 is just three consecutive components, so work on the flat component arrays.
+		static_assert(sizeof(Vector3) == 3 * sizeof(real_t));
+		real_t *w = &p_instance->ptrw()->coord[0];
+		const real_t *r = &p_array.ptr()->coord[0];
+		_packed_bulk_for(p_instance->size(), [w, r](int p_begin, int p_end) {
+			for (int i = p_begin * 3; i < p_end * 3; i++) {
+				w[i] += r[i];
+			}
+		});
+	}
+
+	static void func_PackedVector3Array_multiply_scalar(PackedVector3Array *p_instance, double p_value) {
+		if (p_instance->is_empty()) {
+			return;
+		}
+		real_t *w = &p_instance->ptrw()->coord[0];
+		const real_t value = p_value;
+		_packed_bulk_for(p_instance->size(), [w, value](int p_begin, int p_end) {
+			for (int i = p_begin * 3; i < p_end * 3; i++) {
+				w[i] *= value;
+			}
+		});
+	}
+
+	static void func_PackedVector3Array_lerp(PackedVector3Array *p_instance, const PackedVector3Array &p_to, double p_weight) {
+		ERR_FAIL_COND_MSG(p_to.size() != p_instance->size(), "Both arrays must have the same size.");
+		if (p_instance->is_empty()) {
+			return;
+		}
+		real_t *w = &p_instance->ptrw()->coord[0];
+		const real_t *r = &p_to.ptr()->coord[0];
+		const real_t weight = p_weight;
+		_packed_bulk_for(p_instance->size(), [w, r, weight](int p_begin, int p_end) {
+			for (int i = p_begin * 3; i < p_end * 3; i++) {
+				w[i] += (r[i] - w[i]) * weight;
+			}
+		});
+	}
+
+	static void func_PackedVector3Array_transform(PackedVector3Array *p_instance, const Transform3D &p_transform) {
+		Vector3 *w = p_instance->ptrw();
+		_packed_bulk_for(p_instance->size(), [w, &p_transform](int p_begin, int p_end) {
+			p_transform.xform_batch(w + p_begin, w + p_begin, p_end - p_begin);
+		});
+	}
+
+	static Vector3 func_PackedVector3Array_sum(PackedVector3Array *p_instance) {
+		const Vector3 *r = p_instance->ptr();
+		const int size = p_instance->size();
+		double lanes[3] = {};
+		for (int i = 0; i < size; i++) {
+			lanes[0] += r[i].x;
+			lanes[1] += r[i].y;
+			lanes[2] += r[i].z;
+		}
+		return Vector3(lanes[0], lanes[1], lanes[2]);
+	}
+
 	static void func_Callable_call(Variant *v, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
 		Callable *callable = VariantGetInternalPtr<Callable>::get_ptr(v);
 		callable->callp(p_args, p_argcount, r_ret, r_error);
@@ -2447,6 +2728,17 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedFloat32Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedFloat32Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat32Array, count, sarray("value"), varray());
+	bind_functionnc(PackedFloat32Array, add_scalar, _VariantCall::func_PackedFloatArray_add_scalar<float>, sarray("value"), varray());
+	bind_functionnc(PackedFloat32Array, multiply_scalar, _VariantCall::func_PackedFloatArray_multiply_scalar<float>, sarray("value"), varray());
+	bind_functionnc(PackedFloat32Array, multiply_add_scalar, _VariantCall::func_PackedFloatArray_multiply_add_scalar<float>, sarray("multiplier", "addend"), varray());
+	bind_functionnc(PackedFloat32Array, add_array, _VariantCall::func_PackedFloatArray_add_array<float>, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, multiply_array, _VariantCall::func_PackedFloatArray_multiply_array<float>, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, clamp, _VariantCall::func_PackedFloatArray_clamp<float>, sarray("min", "max"), varray());
+	bind_functionnc(PackedFloat32Array, lerp, _VariantCall::func_PackedFloatArray_lerp<float>, sarray("to", "weight"), varray());
+	bind_function(PackedFloat32Array, dot, _VariantCall::func_PackedFloatArray_dot<float>, sarray("array"), varray());
+	bind_function(PackedFloat32Array, sum, _VariantCall::func_PackedFloatArray_sum<float>, sarray(), varray());
+	bind_function(PackedFloat32Array, min, _VariantCall::func_PackedFloatArray_min<float>, sarray(), varray());
+	bind_function(PackedFloat32Array, max, _VariantCall::func_PackedFloatArray_max<float>, sarray(), varray());
 
 	/* Float64 Array */
 
@@ -2471,6 +2763,17 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedFloat64Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedFloat64Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat64Array, count, sarray("value"), varray());
+	bind_functionnc(PackedFloat64Array, add_scalar, _VariantCall::func_PackedFloatArray_add_scalar<double>, sarray("value"), varray());
+	bind_functionnc(PackedFloat64Array, multiply_scalar, _VariantCall::func_PackedFloatArray_multiply_scalar<double>, sarray("value"), varray());
+	bind_functionnc(PackedFloat64Array, multiply_add_scalar, _VariantCall::func_PackedFloatArray_multiply_add_scalar<double>, sarray("multiplier", "addend"), varray());
+	bind_functionnc(PackedFloat64Array, add_array, _VariantCall::func_PackedFloatArray_add_array<double>, sarray("array"), varray());
+	bind_functionnc(PackedFloat64Array, multiply_array, _VariantCall::func_PackedFloatArray_multiply_array<double>, sarray("array"), varray());
+	bind_functionnc(PackedFloat64Array, clamp, _VariantCall::func_PackedFloatArray_clamp<double>, sarray("min", "max"), varray());
+	bind_functionnc(PackedFloat64Array, lerp, _VariantCall::func_PackedFloatArray_lerp<double>, sarray("to", "weight"), varray());
+	bind_function(PackedFloat64Array, dot, _VariantCall::func_PackedFloatArray_dot<double>, sarray("array"), varray());
+	bind_function(PackedFloat64Array, sum, _VariantCall::func_PackedFloatArray_sum<double>, sarray(), varray());
+	bind_function(PackedFloat64Array, min, _VariantCall::func_PackedFloatArray_min<double>, sarray(), varray());
+	bind_function(PackedFloat64Array, max, _VariantCall::func_PackedFloatArray_max<double>, sarray(), varray());
 
 	/* String Array */
 
@@ -2543,6 +2846,11 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedVector3Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedVector3Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector3Array, count, sarray("value"), varray());
+	bind_functionnc(PackedVector3Array, add_array, _VariantCall::func_PackedVector3Array_add_array, sarray("array"), varray());
+	bind_functionnc(PackedVector3Array, multiply_scalar, _VariantCall::func_PackedVector3Array_multiply_scalar, sarray("value"), varray());
+	bind_functionnc(PackedVector3Array, lerp, _VariantCall::func_PackedVector3Array_lerp, sarray("to", "weight"), varray());
+	bind_functionnc(PackedVector3Array, transform, _VariantCall::func_PackedVector3Array_transform, sarray("transform"), varray());
+	bind_function(PackedVector3Array, sum, _VariantCall::func_PackedVector3Array_sum, sarray(), varray());
 
 	/* Color Array */
 
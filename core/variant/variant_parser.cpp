@@ -36,13 +36,9 @@
 #include "core/object/script_language.h"
 #include "core/os/keyboard.h"
 #include "core/string/string_buffer.h"
+#include "core/templates/local_vector.h"
 
-char32_t VariantParser::Stream::get_char() {
-	// is within buffer?
-	if (readahead_pointer < readahead_filled) {
-		return readahead_buffer[readahead_pointer++];
-	}
-
+char32_t VariantParser::Stream::_get_char_slow() {
 	// attempt to readahead
 	readahead_filled = _read_buffer(readahead_buffer, readahead_enabled ? READAHEAD_SIZE : 1);
 	if (readahead_filled) {
@@ -75,9 +71,15 @@ uint32_t VariantParser::StreamFile::_read_buffer(char32_t *p_buffer, uint32_t p_
 	// The buffer is assumed to include at least one character (for null terminator)
 	ERR_FAIL_COND_V(!p_num_chars, 0);
 
-	uint8_t *temp = (uint8_t *)alloca(p_num_chars);
-	uint64_t num_read = f->get_buffer(temp, p_num_chars);
-	ERR_FAIL_COND_V(num_read == UINT64_MAX, 0);
+	// Read straight from the file's memory when it can be mapped, instead of copying it first.
+	const uint8_t *temp = f->get_buffer_view(p_num_chars);
+	uint64_t num_read = p_num_chars;
+	if (!temp) {
+		uint8_t *buf = (uint8_t *)alloca(p_num_chars);
+		num_read = f->get_buffer(buf, p_num_chars);
+		ERR_FAIL_COND_V(num_read == UINT64_MAX, 0);
+		temp = buf;
+	}
 
 	// translate to wchar
 	for (uint32_t n = 0; n < num_read; n++) {
@@ -157,6 +159,80 @@ static double stor_fix(const String &p_str) {
 	return -1;
 }
 
+// Reads a number starting with p_char into r_num, and returns whether it's a float.
+// The first character after the number is left in p_stream->saved.
+static bool _read_number(VariantParser::Stream *p_stream, char32_t p_char, StringBuffer<> &r_num) {
+#define READING_SIGN 0
+#define READING_INT 1
+#define READING_DEC 2
+#define READING_EXP 3
+#define READING_DONE 4
+	int reading = READING_INT;
+
+	if (p_char == '-') {
+		r_num += '-';
+		p_char = p_stream->get_char();
+	}
+
+	char32_t c = p_char;
+	bool exp_sign = false;
+	bool exp_beg = false;
+	bool is_float = false;
+
+	while (true) {
+		switch (reading) {
+			case READING_INT: {
+				if (is_digit(c)) {
+					//pass
+				} else if (c == '.') {
+					reading = READING_DEC;
+					is_float = true;
+				} else if (c == 'e') {
+					reading = READING_EXP;
+					is_float = true;
+				} else {
+					reading = READING_DONE;
+				}
+
+			} break;
+			case READING_DEC: {
+				if (is_digit(c)) {
+				} else if (c == 'e') {
+					reading = READING_EXP;
+				} else {
+					reading = READING_DONE;
+				}
+
+			} break;
+			case READING_EXP: {
+				if (is_digit(c)) {
+					exp_beg = true;
+
+				} else if ((c == '-' || c == '+') && !exp_sign && !exp_beg) {
+					exp_sign = true;
+
+				} else {
+					reading = READING_DONE;
+				}
+			} break;
+		}
+
+		if (reading == READING_DONE) {
+			break;
+		}
+		r_num += c;
+		c = p_stream->get_char();
+	}
+#undef READING_SIGN
+#undef READING_INT
+#undef READING_DEC
+#undef READING_EXP
+#undef READING_DONE
+
+	p_stream->saved = c;
+	return is_float;
+}
+
 Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, String &r_err_str) {
 	bool string_name = false;
 
@@ -417,69 +493,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 					//a number
 
 					StringBuffer<> num;
-#define READING_SIGN 0
-#define READING_INT 1
-#define READING_DEC 2
-#define READING_EXP 3
-#define READING_DONE 4
-					int reading = READING_INT;
-
-					if (cchar == '-') {
-						num += '-';
-						cchar = p_stream->get_char();
-					}
-
-					char32_t c = cchar;
-					bool exp_sign = false;
-					bool exp_beg = false;
-					bool is_float = false;
-
-					while (true) {
-						switch (reading) {
-							case READING_INT: {
-								if (is_digit(c)) {
-									//pass
-								} else if (c == '.') {
-									reading = READING_DEC;
-									is_float = true;
-								} else if (c == 'e') {
-									reading = READING_EXP;
-									is_float = true;
-								} else {
-									reading = READING_DONE;
-								}
-
-							} break;
-							case READING_DEC: {
-								if (is_digit(c)) {
-								} else if (c == 'e') {
-									reading = READING_EXP;
-								} else {
-									reading = READING_DONE;
-								}
-
-							} break;
-							case READING_EXP: {
-								if (is_digit(c)) {
-									exp_beg = true;
-
-								} else if ((c == '-' || c == '+') && !exp_sign && !exp_beg) {
-									exp_sign = true;
-
-								} else {
-									reading = READING_DONE;
-								}
-							} break;
-						}
-
-						if (reading == READING_DONE) {
-							break;
-						}
-						num += c;
-						c = p_stream->get_char();
-					}
-
-					p_stream->saved = c;
+					bool is_float = _read_number(p_stream, cchar, num);
 
 					r_token.type = TK_NUMBER;
 
@@ -547,6 +561,39 @@ Error VariantParser::_parse_enginecfg(Stream *p_stream, Vector<String> &strings,
 	}
 }
 
+// Returns the next character that is not whitespace or part of a comment, or 0 at the end of the stream.
+static char32_t _skip_to_token(VariantParser::Stream *p_stream, int &line) {
+	while (true) {
+		char32_t c;
+		if (p_stream->saved) {
+			c = p_stream->saved;
+			p_stream->saved = 0;
+		} else {
+			c = p_stream->get_char();
+			if (p_stream->is_eof()) {
+				return 0;
+			}
+		}
+
+		if (c == '\n') {
+			line++;
+		} else if (c == ';') {
+			while (true) {
+				c = p_stream->get_char();
+				if (p_stream->is_eof()) {
+					return 0;
+				}
+				if (c == '\n') {
+					line++;
+					break;
+				}
+			}
+		} else if (c == 0 || c > 32) {
+			return c;
+		}
+	}
+}
+
 template <typename T>
 Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct, int &line, String &r_err_str) {
 	Token token;
@@ -556,43 +603,58 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 		return ERR_PARSE_ERROR;
 	}
 
+	// Only numbers are valid here, so they are read directly rather than through get_token(),
+	// which builds a Variant for each of them. This matters for large packed arrays.
+	LocalVector<T> values;
 	bool first = true;
 	while (true) {
+		char32_t c = _skip_to_token(p_stream, line);
 		if (!first) {
-			get_token(p_stream, token, line, r_err_str);
-			if (token.type == TK_COMMA) {
-				//do none
-			} else if (token.type == TK_PARENTHESIS_CLOSE) {
+			if (c == ')') {
 				break;
-			} else {
+			} else if (c != ',') {
 				r_err_str = "Expected ',' or ')' in constructor";
 				return ERR_PARSE_ERROR;
 			}
+			c = _skip_to_token(p_stream, line);
 		}
-		get_token(p_stream, token, line, r_err_str);
 
-		if (first && token.type == TK_PARENTHESIS_CLOSE) {
+		if (first && c == ')') {
 			break;
-		} else if (token.type != TK_NUMBER) {
-			bool valid = false;
-			if (token.type == TK_IDENTIFIER) {
-				double real = stor_fix(token.value);
-				if (real != -1) {
-					token.type = TK_NUMBER;
-					token.value = real;
-					valid = true;
-				}
+		} else if (c == '-' || is_digit(c)) {
+			StringBuffer<> num;
+			if (_read_number(p_stream, c, num)) {
+				values.push_back((T)num.as_double());
+			} else {
+				values.push_back((T)num.as_int());
 			}
-			if (!valid) {
+		} else if (is_ascii_alphabet_char(c) || is_underscore(c)) {
+			StringBuffer<> id;
+			while (is_ascii_alphabet_char(c) || is_underscore(c) || is_digit(c)) {
+				id += c;
+				c = p_stream->get_char();
+			}
+			p_stream->saved = c;
+
+			double real = stor_fix(id);
+			if (real == -1) {
 				r_err_str = "Expected float in constructor";
 				return ERR_PARSE_ERROR;
 			}
+			values.push_back((T)real);
+		} else {
+			r_err_str = "Expected float in constructor";
+			return ERR_PARSE_ERROR;
 		}
 
-		r_construct.push_back(token.value);
 		first = false;
 	}
 
+	r_construct.resize(values.size());
+	if (values.size()) {
+		memcpy(r_construct.ptrw(), values.ptr(), values.size() * sizeof(T));
+	}
+
 	return OK;
 }
 
@@ -1248,17 +1310,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int32_t> arr;
-			{
-				int32_t len = args.size();
-				arr.resize(len);
-				int32_t *w = arr.ptrw();
-				for (int32_t i = 0; i < len; i++) {
-					w[i] = int32_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedInt64Array") {
 			Vector<int64_t> args;
 			Error err = _parse_construct<int64_t>(p_stream, args, line, r_err_str);
@@ -1266,17 +1318,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int64_t> arr;
-			{
-				int64_t len = args.size();
-				arr.resize(len);
-				int64_t *w = arr.ptrw();
-				for (int64_t i = 0; i < len; i++) {
-					w[i] = int64_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat32Array" || id == "PackedRealArray" || id == "PoolRealArray" || id == "FloatArray") {
 			Vector<float> args;
 			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
@@ -1284,17 +1326,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<float> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				float *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat64Array") {
 			Vector<double> args;
 			Error err = _parse_construct<double>(p_stream, args, line, r_err_str);
@@ -1302,17 +1334,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<double> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				double *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedStringArray" || id == "PoolStringArray" || id == "StringArray") {
 			get_token(p_stream, token, line, r_err_str);
 			if (token.type != TK_PARENTHESIS_OPEN) {
@@ -45,6 +45,8 @@ public:
 		uint32_t readahead_filled = 0;
 		bool eof = false;
 
+		char32_t _get_char_slow();
+
 	protected:
 		bool readahead_enabled = true;
 		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) = 0;
@@ -53,7 +55,13 @@ public:
 	public:
 		char32_t saved = 0;
 
-		char32_t get_char();
+		_FORCE_INLINE_ char32_t get_char() {
+			// is within buffer?
+			if (readahead_pointer < readahead_filled) {
+				return readahead_buffer[readahead_pointer++];
+			}
+			return _get_char_slow();
+		}
 		virtual bool is_utf8() const = 0;
 		bool is_eof() const;
 
@@ -37,6 +37,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -142,6 +143,14 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	for (const MappedWindow &window : mapped_windows) {
+		munmap(window.data, window.size);
+	}
+	mapped_windows.clear();
+	mapped_file_length = 0;
+	map_failed = false;
+	view_position = -1;
+
 	fclose(f);
 	f = nullptr;
 
@@ -177,6 +186,7 @@ void FileAccessUnix::seek(uint64_t p_position) {
 	ERR_FAIL_NULL_MSG(f, "File must be opened before use.");
 
 	last_error = OK;
+	view_position = -1;
 	if (fseeko(f, p_position, SEEK_SET)) {
 		check_errors();
 	}
@@ -185,6 +195,7 @@ void FileAccessUnix::seek(uint64_t p_position) {
 void FileAccessUnix::seek_end(int64_t p_position) {
 	ERR_FAIL_NULL_MSG(f, "File must be opened before use.");
 
+	view_position = -1;
 	if (fseeko(f, p_position, SEEK_END)) {
 		check_errors();
 	}
@@ -193,6 +204,10 @@ void FileAccessUnix::seek_end(int64_t p_position) {
 uint64_t FileAccessUnix::get_position() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
 
+	if (view_position >= 0) {
+		return view_position;
+	}
+
 	int64_t pos = ftello(f);
 	if (pos < 0) {
 		check_errors();
@@ -220,6 +235,7 @@ bool FileAccessUnix::eof_reached() const {
 
 uint8_t FileAccessUnix::get_8() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
+	_sync_view_position();
 	uint8_t b;
 	if (fread(&b, 1, 1, f) == 0) {
 		check_errors();
@@ -230,6 +246,7 @@ uint8_t FileAccessUnix::get_8() const {
 
 uint16_t FileAccessUnix::get_16() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
+	_sync_view_position();
 
 	uint16_t b = 0;
 	if (fread(&b, 1, 2, f) != 2) {
@@ -245,6 +262,7 @@ uint16_t FileAccessUnix::get_16() const {
 
 uint32_t FileAccessUnix::get_32() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
+	_sync_view_position();
 
 	uint32_t b = 0;
 	if (fread(&b, 1, 4, f) != 4) {
@@ -260,6 +278,7 @@ uint32_t FileAccessUnix::get_32() const {
 
 uint64_t FileAccessUnix::get_64() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
+	_sync_view_position();
 
 	uint64_t b = 0;
 	if (fread(&b, 1, 8, f) != 8) {
@@ -276,12 +295,87 @@ uint64_t FileAccessUnix::get_64() const {
 uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 	ERR_FAIL_NULL_V_MSG(f, -1, "File must be opened before use.");
+	_sync_view_position();
 
 	uint64_t read = fread(p_dst, 1, p_length, f);
 	check_errors();
 	return read;
 }
 
+void FileAccessUnix::_sync_view_position() const {
+	if (view_position < 0) {
+		return;
+	}
+	if (fseeko(f, view_position, SEEK_SET)) {
+		check_errors();
+	}
+	view_position = -1;
+}
+
+const FileAccessUnix::MappedWindow *FileAccessUnix::_map_window(uint64_t p_offset, uint64_t p_length) const {
+	// Most views are read in order, so the last window usually holds the range already.
+	for (int64_t i = int64_t(mapped_windows.size()) - 1; i >= 0; i--) {
+		const MappedWindow &window = mapped_windows[i];
+		if (p_offset >= window.offset && p_offset + p_length <= window.offset + window.size) {
+			return &window;
+		}
+	}
+
+	// Map a bit more than asked, so that a run of small views doesn't need a mapping each.
+	static const uint64_t min_window_size = 1024 * 1024;
+	static const uint64_t page_size = sysconf(_SC_PAGESIZE);
+	MappedWindow window;
+	window.offset = p_offset - p_offset % page_size;
+	window.size = MIN(MAX(p_offset + p_length - window.offset, min_window_size), mapped_file_length - window.offset);
+
+	void *data = mmap(nullptr, window.size, PROT_READ, MAP_PRIVATE, fileno(f), window.offset);
+	if (data == MAP_FAILED) {
+		return nullptr;
+	}
+	window.data = (uint8_t *)data;
+	mapped_windows.push_back(window);
+	return &mapped_windows[mapped_windows.size() - 1];
+}
+
+const uint8_t *FileAccessUnix::get_buffer_view(uint64_t p_length) const {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+
+	// Only map files opened for reading, so the mappings can't go stale.
+	if (flags != READ || map_failed || p_length == 0) {
+		return nullptr;
+	}
+
+	if (mapped_windows.is_empty()) {
+		struct stat st = {};
+		if (fstat(fileno(f), &st) != 0) {
+			map_failed = true;
+			return nullptr;
+		}
+		mapped_file_length = st.st_size;
+	}
+
+	uint64_t pos = view_position;
+	if (view_position < 0) {
+		int64_t stream_pos = ftello(f);
+		if (stream_pos < 0) {
+			return nullptr;
+		}
+		pos = stream_pos;
+	}
+	if (pos + p_length > mapped_file_length) {
+		return nullptr;
+	}
+
+	const MappedWindow *window = _map_window(pos, p_length);
+	if (!window) {
+		map_failed = true;
+		return nullptr;
+	}
+
+	view_position = pos + p_length;
+	return window->data + (pos - window->offset);
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -33,6 +33,7 @@
 
 #include "core/io/file_access.h"
 #include "core/os/memory.h"
+#include "core/templates/local_vector.h"
 
 #include <stdio.h>
 
@@ -49,6 +50,20 @@ class FileAccessUnix : public FileAccess {
 	String path;
 	String path_src;
 
+	// Read-only mappings of the ranges returned by get_buffer_view(), kept until the file is closed.
+	struct MappedWindow {
+		uint8_t *data = nullptr;
+		uint64_t offset = 0;
+		uint64_t size = 0;
+	};
+	mutable LocalVector<MappedWindow> mapped_windows;
+	mutable uint64_t mapped_file_length = 0;
+	mutable bool map_failed = false;
+	// Position after the last view, the stream is only moved there when it's read from again.
+	mutable int64_t view_position = -1;
+
+	const MappedWindow *_map_window(uint64_t p_offset, uint64_t p_length) const;
+	void _sync_view_position() const;
 	void _close();
 
 public:
@@ -72,6 +87,7 @@ public:
 	virtual uint32_t get_32() const override;
 	virtual uint64_t get_64() const override;
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const override;
 
 	virtual Error get_error() const override; ///< get last error
 
@@ -33,8 +33,9 @@
 #include "core/config/project_settings.h"
 #include "core/crypto/crypto_core.h"
 #include "core/extension/gdextension.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
-#include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
+#include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION, PackIndexWriter
 #include "core/io/zip_io.h"
 #include "core/version.h"
 #include "editor/editor_file_system.h"
@@ -244,31 +245,6 @@ Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_pa
 		}
 	}
 
-	Ref<FileAccessEncrypted> fae;
-	Ref<FileAccess> ftmp = pd->f;
-
-	if (sd.encrypted) {
-		fae.instantiate();
-		ERR_FAIL_COND_V(fae.is_null(), ERR_SKIP);
-
-		Error err = fae->open_and_parse(ftmp, p_key, FileAccessEncrypted::MODE_WRITE_AES256, false);
-		ERR_FAIL_COND_V(err != OK, ERR_SKIP);
-		ftmp = fae;
-	}
-
-	// Store file content.
-	ftmp->store_buffer(p_data.ptr(), p_data.size());
-
-	if (fae.is_valid()) {
-		ftmp.unref();
-		fae.unref();
-	}
-
-	int pad = _get_pad(PCK_PADDING, pd->f->get_position());
-	for (int i = 0; i < pad; i++) {
-		pd->f->store_8(0);
-	}
-
 	// Store MD5 of original file.
 	{
 		unsigned char hash[16];
@@ -279,6 +255,53 @@ Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_pa
 		}
 	}
 
+	// Files with identical contents point to the same data, which is only stored once.
+	const String content_key = String::hex_encode_buffer(sd.md5.ptr(), 16) + "-" + itos(sd.size) + (sd.encrypted ? "-e" : "");
+	HashMap<String, int>::ConstIterator E = pd->stored_contents.find(content_key);
+	if (E) {
+		const SavedData &stored = pd->file_ofs[E->value];
+		sd.ofs = stored.ofs;
+		sd.compressed = stored.compressed;
+	} else {
+		pd->stored_contents[content_key] = pd->file_ofs.size();
+
+		Vector<uint8_t> compressed_data;
+		if (pd->compress && p_data.size() >= PACK_COMPRESSION_MIN_SIZE) {
+			compressed_data = FileAccessCompressed::compress_buffer(p_data.ptr(), p_data.size(), PACK_COMPRESSION_MAGIC, Compression::MODE_ZSTD, PACK_COMPRESSION_BLOCK_SIZE);
+			// Not worth decompressing on load if it barely shrinks (e.g. already compressed formats).
+			sd.compressed = !compressed_data.is_empty() && compressed_data.size() <= p_data.size() - p_data.size() / 8;
+		}
+
+		Ref<FileAccessEncrypted> fae;
+		Ref<FileAccess> ftmp = pd->f;
+
+		if (sd.encrypted) {
+			fae.instantiate();
+			ERR_FAIL_COND_V(fae.is_null(), ERR_SKIP);
+
+			Error err = fae->open_and_parse(ftmp, p_key, FileAccessEncrypted::MODE_WRITE_AES256, false);
+			ERR_FAIL_COND_V(err != OK, ERR_SKIP);
+			ftmp = fae;
+		}
+
+		// Store file content.
+		if (sd.compressed) {
+			ftmp->store_buffer(compressed_data.ptr(), compressed_data.size());
+		} else {
+			ftmp->store_buffer(p_data.ptr(), p_data.size());
+		}
+
+		if (fae.is_valid()) {
+			ftmp.unref();
+			fae.unref();
+		}
+
+		int pad = _get_pad(PCK_PADDING, pd->f->get_position());
+		for (int i = 0; i < pad; i++) {
+			pd->f->store_8(0);
+		}
+	}
+
 	pd->file_ofs.push_back(sd);
 
 	// TRANSLATORS: This is an editor progress label describing the storing of a file.
@@ -1562,6 +1585,7 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 	pd.ep = &ep;
 	pd.f = ftmp;
 	pd.so_files = p_so_files;
+	pd.compress = GLOBAL_GET("editor/export/compress_pack_files");
 
 	Error err = export_project_files(p_preset, p_debug, _save_pack_file, &pd, _add_shared_object);
 
@@ -1623,6 +1647,8 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 	bool enc_directory = p_preset->get_enc_directory();
 	if (enc_pck && enc_directory) {
 		pack_flags |= PACK_DIR_ENCRYPTED;
+	} else {
+		pack_flags |= PACK_HASHED_INDEX;
 	}
 	if (p_embed) {
 		pack_flags |= PACK_REL_FILEBASE;
@@ -1703,6 +1729,9 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 		if (pd.file_ofs[i].encrypted) {
 			flags |= PACK_FILE_ENCRYPTED;
 		}
+		if (pd.file_ofs[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 	}
 
@@ -1711,6 +1740,23 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 		fae.unref();
 	}
 
+	if (pack_flags & PACK_HASHED_INDEX) {
+		// Lets the pack be mounted without reading its whole file table.
+		PackIndexWriter index;
+		for (int i = 0; i < pd.file_ofs.size(); i++) {
+			String path;
+			path.parse_utf8(pd.file_ofs[i].path_utf8.get_data());
+			index.add_file(path, pd.file_ofs[i].ofs, pd.file_ofs[i].size, pd.file_ofs[i].md5.ptr(), (pd.file_ofs[i].encrypted ? PACK_FILE_ENCRYPTED : 0) | (pd.file_ofs[i].compressed ? PACK_FILE_COMPRESSED : 0));
+		}
+
+		uint64_t index_ofs = f->get_position();
+		index.store(f);
+		uint64_t index_end = f->get_position();
+		f->seek(file_base_ofs + 8);
+		f->store_64(index_ofs - pck_start_pos); // The first reserved words.
+		f->seek(index_end);
+	}
+
 	int header_padding = _get_pad(PCK_PADDING, f->get_position());
 	for (int i = 0; i < header_padding; i++) {
 		f->store_8(0);
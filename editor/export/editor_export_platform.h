@@ -74,6 +74,7 @@ private:
 		uint64_t ofs = 0;
 		uint64_t size = 0;
 		bool encrypted = false;
+		bool compressed = false;
 		Vector<uint8_t> md5;
 		CharString path_utf8;
 
@@ -85,6 +86,8 @@ private:
 	struct PackData {
 		Ref<FileAccess> f;
 		Vector<SavedData> file_ofs;
+		HashMap<String, int> stored_contents; // Content key to the index in file_ofs where that data is stored.
+		bool compress = false;
 		EditorProgress *ep = nullptr;
 		Vector<SharedObject> *so_files = nullptr;
 	};
@@ -1779,6 +1779,7 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 #else
 		WorkerThreadPool::get_singleton()->init(0, 0);
 #endif
+		ResourceLoader::set_max_concurrent_loads(GLOBAL_GET("threading/worker_pool/max_concurrent_resource_loads"));
 	}
 
 #ifdef TOOLS_ENABLED
@@ -2360,6 +2361,9 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 		OS::get_singleton()->_verbose_stdout = GLOBAL_GET("debug/settings/stdout/verbose_stdout");
 	}
 
+	GLOBAL_DEF("debug/settings/memory/count_tagged_allocations_in_release", false);
+	Memory::set_tag_counting_enabled(GLOBAL_GET("debug/settings/memory/count_tagged_allocations_in_release"));
+
 #if defined(MACOS_ENABLED) || defined(IOS_ENABLED)
 	OS::get_singleton()->set_environment("MVK_CONFIG_LOG_LEVEL", OS::get_singleton()->_verbose_stdout ? "3" : "1"); // 1 = Errors only, 3 = Info
 #endif
@@ -4026,13 +4030,17 @@ bool Main::iteration() {
 
 		message_queue->flush();
 
+		{
+			MemoryTagScope memory_tag(Memory::TAG_PHYSICS);
+
 #ifndef _3D_DISABLED
-		PhysicsServer3D::get_singleton()->end_sync();
-		PhysicsServer3D::get_singleton()->step(physics_step * time_scale);
+			PhysicsServer3D::get_singleton()->end_sync();
+			PhysicsServer3D::get_singleton()->step(physics_step * time_scale);
 #endif // _3D_DISABLED
 
-		PhysicsServer2D::get_singleton()->end_sync();
-		PhysicsServer2D::get_singleton()->step(physics_step * time_scale);
+			PhysicsServer2D::get_singleton()->end_sync();
+			PhysicsServer2D::get_singleton()->step(physics_step * time_scale);
+		}
 
 		message_queue->flush();
 
@@ -4185,6 +4193,7 @@ void Main::cleanup(bool p_force) {
 	}
 
 	ResourceLoader::clear_thread_load_tasks();
+	ResourceSaver::wait_for_threaded_saves();
 
 	ResourceLoader::remove_custom_loaders();
 	ResourceSaver::remove_custom_savers();
@@ -91,6 +91,14 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_MERGE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_FREE_COUNT);
+	BIND_ENUM_CONSTANT(MEMORY_RENDERING);
+	BIND_ENUM_CONSTANT(MEMORY_PHYSICS);
+	BIND_ENUM_CONSTANT(MEMORY_SCRIPT);
+	BIND_ENUM_CONSTANT(MEMORY_RESOURCES);
+	BIND_ENUM_CONSTANT(MEMORY_RENDERING_ALLOCATIONS);
+	BIND_ENUM_CONSTANT(MEMORY_PHYSICS_ALLOCATIONS);
+	BIND_ENUM_CONSTANT(MEMORY_SCRIPT_ALLOCATIONS);
+	BIND_ENUM_CONSTANT(MEMORY_RESOURCES_ALLOCATIONS);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -141,6 +149,14 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation/edges_merged"),
 		PNAME("navigation/edges_connected"),
 		PNAME("navigation/edges_free"),
+		PNAME("memory/rendering"),
+		PNAME("memory/physics"),
+		PNAME("memory/script"),
+		PNAME("memory/resources"),
+		PNAME("memory/rendering_allocations"),
+		PNAME("memory/physics_allocations"),
+		PNAME("memory/script_allocations"),
+		PNAME("memory/resources_allocations"),
 
 	};
 
@@ -225,6 +241,22 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT);
 		case NAVIGATION_EDGE_FREE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT);
+		case MEMORY_RENDERING:
+			return Memory::get_tag_mem_usage(Memory::TAG_RENDERING);
+		case MEMORY_PHYSICS:
+			return Memory::get_tag_mem_usage(Memory::TAG_PHYSICS);
+		case MEMORY_SCRIPT:
+			return Memory::get_tag_mem_usage(Memory::TAG_SCRIPT);
+		case MEMORY_RESOURCES:
+			return Memory::get_tag_mem_usage(Memory::TAG_RESOURCES);
+		case MEMORY_RENDERING_ALLOCATIONS:
+			return Memory::get_tag_alloc_count(Memory::TAG_RENDERING);
+		case MEMORY_PHYSICS_ALLOCATIONS:
+			return Memory::get_tag_alloc_count(Memory::TAG_PHYSICS);
+		case MEMORY_SCRIPT_ALLOCATIONS:
+			return Memory::get_tag_alloc_count(Memory::TAG_SCRIPT);
+		case MEMORY_RESOURCES_ALLOCATIONS:
+			return Memory::get_tag_alloc_count(Memory::TAG_RESOURCES);
 
 		default: {
 		}
@@ -272,6 +304,14 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
 
 	};
 
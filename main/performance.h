@@ -100,6 +100,14 @@ public:
 		NAVIGATION_EDGE_MERGE_COUNT,
 		NAVIGATION_EDGE_CONNECTION_COUNT,
 		NAVIGATION_EDGE_FREE_COUNT,
+		MEMORY_RENDERING,
+		MEMORY_PHYSICS,
+		MEMORY_SCRIPT,
+		MEMORY_RESOURCES,
+		MEMORY_RENDERING_ALLOCATIONS,
+		MEMORY_PHYSICS_ALLOCATIONS,
+		MEMORY_SCRIPT_ALLOCATIONS,
+		MEMORY_RESOURCES_ALLOCATIONS,
 		MONITOR_MAX
 	};
 
@@ -35,6 +35,7 @@
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
 #include "gdscript_rpc_callable.h"
+#include "gdscript_sampling_profiler.h"
 #include "gdscript_tokenizer_buffer.h"
 #include "gdscript_warning.h"
 
@@ -729,6 +730,8 @@ Error GDScript::reload(bool p_keep_state) {
 	if (reloading) {
 		return OK;
 	}
+
+	MemoryTagScope memory_tag(Memory::TAG_SCRIPT);
 	reloading = true;
 
 	bool has_instances;
@@ -758,22 +761,27 @@ Error GDScript::reload(bool p_keep_state) {
 	}
 #endif
 
-	{
-		String source_path = path;
-		if (source_path.is_empty()) {
-			source_path = get_path();
-		}
-		if (!source_path.is_empty()) {
-			if (GDScriptCache::get_cached_script(source_path).is_null()) {
-				MutexLock lock(GDScriptCache::singleton->mutex);
-				GDScriptCache::singleton->shallow_gdscript_cache[source_path] = Ref<GDScript>(this);
-			}
-			if (GDScriptCache::has_parser(source_path)) {
-				Error err = OK;
-				Ref<GDScriptParserRef> parser_ref = GDScriptCache::get_parser(source_path, GDScriptParserRef::EMPTY, err);
-				if (parser_ref.is_valid() && parser_ref->get_source_hash() != source.hash()) {
-					GDScriptCache::remove_parser(source_path);
-				}
+	String source_path = path;
+	if (source_path.is_empty()) {
+		source_path = get_path();
+	}
+
+	// Parser state built by the cache while resolving dependencies. When it is still up to date it is
+	// reused below instead of parsing and analyzing the whole script a second time.
+	Ref<GDScriptParserRef> cached_parser_ref;
+	if (!source_path.is_empty()) {
+		if (GDScriptCache::get_cached_script(source_path).is_null()) {
+			MutexLock lock(GDScriptCache::singleton->mutex);
+			GDScriptCache::singleton->shallow_gdscript_cache[source_path] = Ref<GDScript>(this);
+		}
+		if (GDScriptCache::has_parser(source_path)) {
+			Error err = OK;
+			Ref<GDScriptParserRef> parser_ref = GDScriptCache::get_parser(source_path, GDScriptParserRef::EMPTY, err);
+			uint32_t current_hash = binary_tokens.is_empty() ? source.hash() : hash_djb2_buffer(binary_tokens.ptr(), binary_tokens.size());
+			if (parser_ref.is_valid() && parser_ref->get_source_hash() != current_hash) {
+				GDScriptCache::remove_parser(source_path);
+			} else if (parser_ref.is_valid() && !Engine::get_singleton()->is_editor_hint()) {
+				cached_parser_ref = parser_ref;
 			}
 		}
 	}
@@ -787,44 +795,58 @@ Error GDScript::reload(bool p_keep_state) {
 #endif
 
 	valid = false;
-	GDScriptParser parser;
+	GDScriptParser local_parser;
+	GDScriptParser *parser = &local_parser;
 	Error err;
-	if (!binary_tokens.is_empty()) {
-		err = parser.parse_binary(binary_tokens, path);
-	} else {
-		err = parser.parse(source, path, false);
-	}
-	if (err) {
-		if (EngineDebugger::is_active()) {
-			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
+
+	if (cached_parser_ref.is_valid()) {
+		// On failure, fall back to a fresh parse below so errors are reported the usual way.
+		err = cached_parser_ref->raise_status(GDScriptParserRef::FULLY_SOLVED);
+		if (err == OK) {
+			parser = cached_parser_ref->get_parser();
+		} else {
+			cached_parser_ref.unref();
 		}
-		// TODO: Show all error messages.
-		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), parser.get_errors().front()->get().line, ("Parse Error: " + parser.get_errors().front()->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
-		reloading = false;
-		return ERR_PARSE_ERROR;
 	}
 
-	GDScriptAnalyzer analyzer(&parser);
-	err = analyzer.analyze();
-
-	if (err) {
-		if (EngineDebugger::is_active()) {
-			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
+	if (cached_parser_ref.is_null()) {
+		if (!binary_tokens.is_empty()) {
+			err = parser->parse_binary(binary_tokens, path);
+		} else {
+			err = parser->parse(source, path, false);
+		}
+		if (err) {
+			if (EngineDebugger::is_active()) {
+				GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser->get_errors().front()->get().line, "Parser Error: " + parser->get_errors().front()->get().message);
+			}
+			// TODO: Show all error messages.
+			_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), parser->get_errors().front()->get().line, ("Parse Error: " + parser->get_errors().front()->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
+			reloading = false;
+			return ERR_PARSE_ERROR;
 		}
 
-		const List<GDScriptParser::ParserError>::Element *e = parser.get_errors().front();
-		while (e != nullptr) {
-			_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), e->get().line, ("Parse Error: " + e->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
-			e = e->next();
+		GDScriptAnalyzer analyzer(parser);
+		err = analyzer.analyze();
+
+		if (err) {
+			if (EngineDebugger::is_active()) {
+				GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser->get_errors().front()->get().line, "Parser Error: " + parser->get_errors().front()->get().message);
+			}
+
+			const List<GDScriptParser::ParserError>::Element *e = parser->get_errors().front();
+			while (e != nullptr) {
+				_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), e->get().line, ("Parse Error: " + e->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
+				e = e->next();
+			}
+			reloading = false;
+			return ERR_PARSE_ERROR;
 		}
-		reloading = false;
-		return ERR_PARSE_ERROR;
 	}
 
-	can_run = ScriptServer::is_scripting_enabled() || parser.is_tool();
+	can_run = ScriptServer::is_scripting_enabled() || parser->is_tool();
 
 	GDScriptCompiler compiler;
-	err = compiler.compile(&parser, this, p_keep_state);
+	err = compiler.compile(parser, this, p_keep_state);
 
 	if (err) {
 		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), compiler.get_error_line(), ("Compile Error: " + compiler.get_error()).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
@@ -843,11 +865,11 @@ Error GDScript::reload(bool p_keep_state) {
 #ifdef TOOLS_ENABLED
 	// Done after compilation because it needs the GDScript object's inner class GDScript objects,
 	// which are made by calling make_scripts() within compiler.compile() above.
-	GDScriptDocGen::generate_docs(this, parser.get_tree());
+	GDScriptDocGen::generate_docs(this, parser->get_tree());
 #endif
 
 #ifdef DEBUG_ENABLED
-	for (const GDScriptWarning &warning : parser.get_warnings()) {
+	for (const GDScriptWarning &warning : parser->get_warnings()) {
 		if (EngineDebugger::is_active()) {
 			Vector<ScriptLanguage::StackInfo> si;
 			EngineDebugger::get_script_debugger()->send_error("", get_script_path(), warning.start_line, warning.get_name(), warning.get_message(), false, ERR_HANDLER_WARNING, si);
@@ -2250,6 +2272,11 @@ void GDScriptLanguage::init() {
 		_add_global(E.name, E.ptr);
 	}
 
+	sampling_profiler_output_path = GLOBAL_GET("debug/gdscript/sampling_profiler/output_path");
+	if (!sampling_profiler_output_path.is_empty() && !Engine::get_singleton()->is_editor_hint()) {
+		GDScriptSamplingProfiler::start(GLOBAL_GET("debug/gdscript/sampling_profiler/frequency"));
+	}
+
 #ifdef TESTS_ENABLED
 	GDScriptTests::GDScriptTestRunner::handle_cmdline();
 #endif
@@ -2264,6 +2291,11 @@ String GDScriptLanguage::get_extension() const {
 }
 
 void GDScriptLanguage::finish() {
+	if (GDScriptSamplingProfiler::is_running()) {
+		GDScriptSamplingProfiler::stop();
+		GDScriptSamplingProfiler::save_collapsed_stacks(sampling_profiler_output_path);
+	}
+
 	_call_stack.free();
 
 	// Clear the cache before parsing the script_list
@@ -2877,6 +2909,9 @@ GDScriptLanguage::GDScriptLanguage() {
 		_debug_max_call_stack = 0;
 	}
 
+	GLOBAL_DEF(PropertyInfo(Variant::STRING, "debug/gdscript/sampling_profiler/output_path", PROPERTY_HINT_GLOBAL_SAVE_FILE, "*.txt"), "");
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "debug/gdscript/sampling_profiler/frequency", PROPERTY_HINT_RANGE, "10,10000,1,suffix:Hz"), 1000);
+
 #ifdef DEBUG_ENABLED
 	GLOBAL_DEF("debug/gdscript/warnings/enable", true);
 	GLOBAL_DEF("debug/gdscript/warnings/exclude_addons", true);
@@ -462,6 +462,7 @@ class GDScriptLanguage : public ScriptLanguage {
 	bool profiling;
 	bool profile_native_calls;
 	uint64_t script_frame_time;
+	String sampling_profiler_output_path;
 
 	HashMap<String, ObjectID> orphan_subclasses;
 
@@ -33,6 +33,7 @@
 #include "gdscript.h"
 
 #include "core/debugger/engine_debugger.h"
+#include "core/templates/hash_set.h"
 
 uint32_t GDScriptByteCodeGenerator::add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) {
 	function->_argument_count++;
@@ -178,6 +179,32 @@ void GDScriptByteCodeGenerator::write_start(GDScript *p_script, const StringName
 	function->_argument_count = 0;
 }
 
+// Nested blocks often end with a jump landing on another unconditional jump
+// (e.g. the end of an `if` inside a loop jumping to the loop's own back jump).
+// Retarget those to the final destination, so only one jump runs at runtime.
+void GDScriptByteCodeGenerator::thread_jumps() {
+	HashSet<int> unconditional_jumps;
+	for (int pos : jump_positions) {
+		if (opcodes[pos] == GDScriptFunction::OPCODE_JUMP) {
+			unconditional_jumps.insert(pos);
+		}
+	}
+
+	for (int pos : jump_positions) {
+		int target_pos = pos + (opcodes[pos] == GDScriptFunction::OPCODE_JUMP ? 1 : 2);
+		int target = opcodes[target_pos];
+		// Bound the walk, since an empty infinite loop jumps to itself.
+		for (uint32_t i = 0; i < unconditional_jumps.size() && unconditional_jumps.has(target); i++) {
+			int next = opcodes[target + 1];
+			if (next == target) {
+				break;
+			}
+			target = next;
+		}
+		opcodes.write[target_pos] = target;
+	}
+}
+
 GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 #ifdef DEBUG_ENABLED
 	if (!used_temporaries.is_empty()) {
@@ -186,6 +213,8 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 #endif
 	append_opcode(GDScriptFunction::OPCODE_END);
 
+	thread_jumps();
+
 	for (int i = 0; i < temporaries.size(); i++) {
 		int stack_index = i + max_locals + GDScriptFunction::FIXED_ADDRESSES_MAX;
 		for (int j = 0; j < temporaries[i].bytecode_indices.size(); j++) {
@@ -852,6 +881,18 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_name);
 }
 
+void GDScriptByteCodeGenerator::write_get_named_script_member(const Address &p_target, const StringName &p_name, int p_member_index, const Address &p_source) {
+	Variant script = p_source.type.script_type;
+	int script_idx = get_constant_pos(script) | (GDScriptFunction::ADDR_TYPE_CONSTANT << GDScriptFunction::ADDR_BITS);
+
+	append_opcode(GDScriptFunction::OPCODE_GET_NAMED_SCRIPT_MEMBER);
+	append(p_source);
+	append(p_target);
+	append(script_idx);
+	append(p_name);
+	append(p_member_index);
+}
+
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
 	append_opcode(GDScriptFunction::OPCODE_SET_MEMBER);
 	append(p_value);
@@ -158,6 +158,9 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	List<List<int>> current_breaks_to_patch;
 
+	// Start of every `JUMP`, `JUMP_IF` and `JUMP_IF_NOT`, so chains of jumps can be shortened at the end.
+	Vector<int> jump_positions;
+
 	void add_stack_identifier(const StringName &p_id, int p_stackpos) {
 		if (locals.size() > max_locals) {
 			max_locals = locals.size();
@@ -374,6 +377,9 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	}
 
 	void append_opcode(GDScriptFunction::Opcode p_code) {
+		if (p_code == GDScriptFunction::OPCODE_JUMP || p_code == GDScriptFunction::OPCODE_JUMP_IF || p_code == GDScriptFunction::OPCODE_JUMP_IF_NOT) {
+			jump_positions.push_back(opcodes.size());
+		}
 		opcodes.push_back(p_code);
 	}
 
@@ -451,6 +457,8 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		opcodes.write[p_address] = opcodes.size();
 	}
 
+	void thread_jumps();
+
 public:
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
@@ -496,6 +504,7 @@ public:
 	virtual void write_get(const Address &p_target, const Address &p_index, const Address &p_source) override;
 	virtual void write_set_named(const Address &p_target, const StringName &p_name, const Address &p_source) override;
 	virtual void write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) override;
+	virtual void write_get_named_script_member(const Address &p_target, const StringName &p_name, int p_member_index, const Address &p_source) override;
 	virtual void write_set_member(const Address &p_value, const StringName &p_name) override;
 	virtual void write_get_member(const Address &p_target, const StringName &p_name) override;
 	virtual void write_set_static_variable(const Address &p_value, const Address &p_class, int p_index) override;
@@ -36,6 +36,9 @@
 #include "gdscript_parser.h"
 
 #include "core/io/file_access.h"
+#include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
 #include "core/templates/vector.h"
 
 GDScriptParserRef::Status GDScriptParserRef::get_status() const {
@@ -71,16 +74,7 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 				// It's ok if its the first thing done here.
 				get_parser()->clear();
 				status = PARSED;
-				String remapped_path = ResourceLoader::path_remap(path);
-				if (remapped_path.get_extension().to_lower() == "gdc") {
-					Vector<uint8_t> tokens = GDScriptCache::get_binary_tokens(remapped_path);
-					source_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
-					result = get_parser()->parse_binary(tokens, path);
-				} else {
-					String source = GDScriptCache::get_source_code(remapped_path);
-					source_hash = source.hash();
-					result = get_parser()->parse(source, path, false);
-				}
+				result = _parse(get_parser(), path, source_hash);
 			} break;
 			case PARSED: {
 				status = INHERITANCE_SOLVED;
@@ -107,6 +101,19 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 	return result;
 }
 
+Error GDScriptParserRef::_parse(GDScriptParser *p_parser, const String &p_path, uint32_t &r_source_hash) {
+	String remapped_path = ResourceLoader::path_remap(p_path);
+	if (remapped_path.get_extension().to_lower() == "gdc") {
+		Vector<uint8_t> tokens = GDScriptCache::get_binary_tokens(remapped_path);
+		r_source_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
+		return p_parser->parse_binary(tokens, p_path);
+	} else {
+		String source = GDScriptCache::get_source_code(remapped_path);
+		r_source_hash = source.hash();
+		return p_parser->parse(source, p_path, false);
+	}
+}
+
 void GDScriptParserRef::clear() {
 	if (clearing) {
 		return;
@@ -220,6 +227,134 @@ Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptP
 	return ref;
 }
 
+void GDScriptCache::_parse_task(uint32_t p_index, ParseTask *p_tasks) {
+	ParseTask &task = p_tasks[p_index];
+	task.result = GDScriptParserRef::_parse(task.parser, task.path, task.source_hash);
+}
+
+void GDScriptCache::_get_parsed_dependencies(const String &p_path, const GDScriptParser *p_parser, Vector<String> &r_paths) {
+	const String base_dir = p_path.get_base_dir();
+
+	List<const GDScriptParser::ClassNode *> classes;
+	classes.push_back(p_parser->get_tree());
+	while (!classes.is_empty()) {
+		const GDScriptParser::ClassNode *class_node = classes.front()->get();
+		classes.pop_front();
+
+		String path;
+		if (!class_node->extends_path.is_empty()) {
+			path = class_node->extends_path;
+		} else if (!class_node->extends.is_empty() && ScriptServer::is_global_class(class_node->extends[0]->name)) {
+			path = ScriptServer::get_global_class_path(class_node->extends[0]->name);
+		}
+		if (!path.is_empty()) {
+			r_paths.push_back(path.is_relative_path() ? base_dir.path_join(path).simplify_path() : path);
+		}
+
+		for (const GDScriptParser::ClassNode::Member &member : class_node->members) {
+			if (member.type == GDScriptParser::ClassNode::Member::CLASS) {
+				classes.push_back(member.m_class);
+			} else if (member.type == GDScriptParser::ClassNode::Member::CONSTANT) {
+				// Only literal preloads can be known before analysis.
+				const GDScriptParser::ExpressionNode *initializer = member.constant->initializer;
+				if (initializer == nullptr || initializer->type != GDScriptParser::Node::PRELOAD) {
+					continue;
+				}
+				const GDScriptParser::ExpressionNode *preload_path = static_cast<const GDScriptParser::PreloadNode *>(initializer)->path;
+				if (preload_path == nullptr || preload_path->type != GDScriptParser::Node::LITERAL) {
+					continue;
+				}
+				const Variant &value = static_cast<const GDScriptParser::LiteralNode *>(preload_path)->value;
+				if (value.get_type() != Variant::STRING) {
+					continue;
+				}
+				path = value;
+				r_paths.push_back(path.is_relative_path() ? base_dir.path_join(path).simplify_path() : path);
+			}
+		}
+	}
+}
+
+int GDScriptCache::parse_scripts(const Vector<String> &p_paths, LocalVector<Ref<GDScriptParserRef>> &r_parsed) {
+	MutexLock lock(singleton->mutex);
+
+	uint64_t begin_time = OS::get_singleton()->get_ticks_usec();
+	// Pool threads may be the ones the pool would need to run the group, so parse inline there.
+	bool use_threads = WorkerThreadPool::get_thread_index() == -1;
+
+	HashSet<String> visited;
+	Vector<String> pending = p_paths;
+	int parsed_count = 0;
+	int wave_count = 0;
+
+	// Scripts are parsed in waves: the first one is made of the requested scripts, then each one is made of the
+	// scripts the previous wave depends on. Scripts within a wave don't share any state and are parsed concurrently.
+	// Analysis needs the whole dependency graph and stays on the calling thread.
+	while (!pending.is_empty()) {
+		LocalVector<ParseTask> tasks;
+		for (const String &path : pending) {
+			if (visited.has(path)) {
+				continue;
+			}
+			visited.insert(path);
+
+			if (singleton->parser_map.has(path) || singleton->full_gdscript_cache.has(path)) {
+				continue;
+			}
+			String remapped_path = ResourceLoader::path_remap(path);
+			String extension = remapped_path.get_extension().to_lower();
+			if ((extension != "gd" && extension != "gdc") || !FileAccess::exists(remapped_path)) {
+				continue;
+			}
+
+			ParseTask task;
+			task.path = path;
+			// Constructed here, as the first parser registers the annotations in a static table.
+			task.parser = memnew(GDScriptParser);
+			tasks.push_back(task);
+		}
+		pending.clear();
+
+		if (tasks.is_empty()) {
+			break;
+		}
+
+		if (use_threads && tasks.size() > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(singleton, &GDScriptCache::_parse_task, tasks.ptr(), tasks.size(), -1, true, SNAME("GDScriptParse"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			for (uint32_t i = 0; i < tasks.size(); i++) {
+				singleton->_parse_task(i, tasks.ptr());
+			}
+		}
+
+		for (ParseTask &task : tasks) {
+			Ref<GDScriptParserRef> ref;
+			ref.instantiate();
+			ref->path = task.path;
+			ref->parser = task.parser;
+			ref->status = GDScriptParserRef::PARSED;
+			ref->result = task.result;
+			ref->source_hash = task.source_hash;
+			singleton->parser_map[task.path] = ref.ptr();
+			r_parsed.push_back(ref);
+
+			if (task.result == OK) {
+				_get_parsed_dependencies(task.path, task.parser, pending);
+			}
+		}
+
+		parsed_count += tasks.size();
+		wave_count++;
+	}
+
+	if (parsed_count > 0) {
+		print_verbose(vformat("GDScript: Parsed %d script(s) in %d dependency wave(s) in %.2f ms.", parsed_count, wave_count, (OS::get_singleton()->get_ticks_usec() - begin_time) / 1000.0));
+	}
+
+	return parsed_count;
+}
+
 bool GDScriptCache::has_parser(const String &p_path) {
 	MutexLock lock(singleton->mutex);
 	return singleton->parser_map.has(p_path);
@@ -320,6 +455,16 @@ Ref<GDScript> GDScriptCache::get_full_script(const String &p_path, Error &r_erro
 		}
 	}
 
+	// Keeps the parsers alive until the dependencies that need them are loaded.
+	LocalVector<Ref<GDScriptParserRef>> parsed_ahead;
+	uint64_t begin_time = 0;
+	if (script.is_null() && !singleton->shallow_gdscript_cache.has(p_path)) {
+		Vector<String> paths;
+		paths.push_back(p_path);
+		parse_scripts(paths, parsed_ahead);
+		begin_time = OS::get_singleton()->get_ticks_usec();
+	}
+
 	if (script.is_null()) {
 		script = get_shallow_script(p_path, r_error);
 		// Only exit early if script failed to load, otherwise let reload report errors.
@@ -352,6 +497,10 @@ Ref<GDScript> GDScriptCache::get_full_script(const String &p_path, Error &r_erro
 	singleton->full_gdscript_cache[p_path] = script;
 	singleton->shallow_gdscript_cache.erase(p_path);
 
+	if (parsed_ahead.size() > 1) {
+		print_verbose(vformat("GDScript: Analyzed and compiled \"%s\" and its dependencies in %.2f ms.", p_path, (OS::get_singleton()->get_ticks_usec() - begin_time) / 1000.0));
+	}
+
 	return script;
 }
 
@@ -37,6 +37,7 @@
 #include "core/os/mutex.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
 
 class GDScriptAnalyzer;
 class GDScriptParser;
@@ -61,6 +62,8 @@ private:
 	uint32_t source_hash = 0;
 	bool clearing = false;
 
+	static Error _parse(GDScriptParser *p_parser, const String &p_path, uint32_t &r_source_hash);
+
 	friend class GDScriptCache;
 	friend class GDScript;
 
@@ -94,10 +97,21 @@ class GDScriptCache {
 
 	Mutex mutex;
 
+	struct ParseTask {
+		String path;
+		GDScriptParser *parser = nullptr;
+		uint32_t source_hash = 0;
+		Error result = OK;
+	};
+
+	void _parse_task(uint32_t p_index, ParseTask *p_tasks);
+	static void _get_parsed_dependencies(const String &p_path, const GDScriptParser *p_parser, Vector<String> &r_paths);
+
 public:
 	static void move_script(const String &p_from, const String &p_to);
 	static void remove_script(const String &p_path);
 	static Ref<GDScriptParserRef> get_parser(const String &p_path, GDScriptParserRef::Status status, Error &r_error, const String &p_owner = String());
+	static int parse_scripts(const Vector<String> &p_paths, LocalVector<Ref<GDScriptParserRef>> &r_parsed);
 	static bool has_parser(const String &p_path);
 	static void remove_parser(const String &p_path);
 	static String get_source_code(const String &p_path);
@@ -251,6 +251,36 @@ static bool _can_use_validate_call(const MethodBind *p_method, const Vector<GDSc
 	return true;
 }
 
+// Non-constant `range(n)` and `range(0, n)` calls in `for` loops can iterate up to `n` directly, like the constant
+// ones reduced by the analyzer, instead of allocating an array with every value.
+// Other forms aren't lowered, since `Vector2i`/`Vector3i` bounds would truncate 64-bit values.
+// Returns the expression of the end bound, or `nullptr` when the call can't be optimized.
+static const GDScriptParser::ExpressionNode *_get_for_range_end(const GDScriptParser::ForNode *p_for) {
+	if (p_for->list == nullptr || p_for->list->is_constant || p_for->list->type != GDScriptParser::Node::CALL) {
+		return nullptr;
+	}
+	const GDScriptParser::CallNode *call = static_cast<const GDScriptParser::CallNode *>(p_for->list);
+	if (call->is_super || call->callee == nullptr || call->callee->type != GDScriptParser::Node::IDENTIFIER || call->function_name != SNAME("range")) {
+		return nullptr;
+	}
+	if (call->arguments.is_empty() || call->arguments.size() > 2) {
+		return nullptr;
+	}
+	if (call->arguments.size() == 2) {
+		const GDScriptParser::ExpressionNode *begin = call->arguments[0];
+		if (!begin->is_constant || begin->reduced_value.get_type() != Variant::INT || (int64_t)begin->reduced_value != 0) {
+			return nullptr;
+		}
+	}
+
+	const GDScriptParser::ExpressionNode *end = call->arguments[call->arguments.size() - 1];
+	GDScriptParser::DataType end_type = end->get_datatype();
+	if (!end_type.is_hard_type() || end_type.kind != GDScriptParser::DataType::BUILTIN || end_type.builtin_type != Variant::INT) {
+		return nullptr;
+	}
+	return end;
+}
+
 GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &codegen, Error &r_error, const GDScriptParser::ExpressionNode *p_expression, bool p_root, bool p_initializer) {
 	if (p_expression->is_constant && !(p_expression->get_datatype().is_meta_type && p_expression->get_datatype().kind == GDScriptParser::DataType::CLASS)) {
 		return codegen.add_constant(p_expression->reduced_value);
@@ -829,7 +859,19 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 			}
 
 			if (named) {
-				gen->write_get_named(result, name, base);
+				// Variables of a GDScript-typed base without a getter can be read by index.
+				const GDScript::MemberInfo *member_info = nullptr;
+				if (subscript->is_attribute && base.type.has_type && base.type.kind == GDScriptDataType::GDSCRIPT) {
+					GDScript *base_script = Object::cast_to<GDScript>(base.type.script_type);
+					if (base_script != nullptr) {
+						member_info = base_script->member_indices.getptr(name);
+					}
+				}
+				if (member_info != nullptr && member_info->getter == StringName()) {
+					gen->write_get_named_script_member(result, name, member_info->index, base);
+				} else {
+					gen->write_get_named(result, name, base);
+				}
 			} else {
 				gen->write_get(result, index, base);
 			}
@@ -1980,6 +2022,19 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			} break;
 			case GDScriptParser::Node::IF: {
 				const GDScriptParser::IfNode *if_n = static_cast<const GDScriptParser::IfNode *>(s);
+
+				if (if_n->condition->is_constant) {
+					// Condition was reduced by the analyzer, only the branch that can run is needed.
+					const GDScriptParser::SuiteNode *taken_block = if_n->condition->reduced_value.booleanize() ? if_n->true_block : if_n->false_block;
+					if (taken_block) {
+						err = _parse_block(codegen, taken_block);
+						if (err) {
+							return err;
+						}
+					}
+					break;
+				}
+
 				GDScriptCodeGenerator::Address condition = _parse_expression(codegen, err, if_n->condition);
 				if (err) {
 					return err;
@@ -2014,9 +2069,19 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 
 				GDScriptCodeGenerator::Address iterator = codegen.add_local(for_n->variable->name, _gdtype_from_datatype(for_n->variable->get_datatype(), codegen.script));
 
-				gen->start_for(iterator.type, _gdtype_from_datatype(for_n->list->get_datatype(), codegen.script));
+				const GDScriptParser::ExpressionNode *range_end = _get_for_range_end(for_n);
+				GDScriptDataType list_type;
+				if (range_end != nullptr) {
+					list_type.has_type = true;
+					list_type.kind = GDScriptDataType::BUILTIN;
+					list_type.builtin_type = Variant::INT;
+				} else {
+					list_type = _gdtype_from_datatype(for_n->list->get_datatype(), codegen.script);
+				}
+
+				gen->start_for(iterator.type, list_type);
 
-				GDScriptCodeGenerator::Address list = _parse_expression(codegen, err, for_n->list);
+				GDScriptCodeGenerator::Address list = _parse_expression(codegen, err, range_end != nullptr ? range_end : for_n->list);
 				if (err) {
 					return err;
 				}
@@ -2198,6 +2263,11 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 		}
 
 		gen->clear_temporaries();
+
+		if (s->type == GDScriptParser::Node::RETURN || s->type == GDScriptParser::Node::BREAK || s->type == GDScriptParser::Node::CONTINUE) {
+			// Anything left in the block is unreachable, no need to compile it.
+			break;
+		}
 	}
 
 	if (p_add_locals && p_clear_locals) {
@@ -301,6 +301,19 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 4;
 			} break;
+			case OPCODE_GET_NAMED_SCRIPT_MEMBER: {
+				text += "get_named script member ";
+				text += DADDR(2);
+				text += " = ";
+				text += DADDR(1);
+				text += "[\"";
+				text += _global_names_ptr[_code_ptr[ip + 4]];
+				text += "\"] (index ";
+				text += itos(_code_ptr[ip + 5]);
+				text += ")";
+
+				incr += 6;
+			} break;
 			case OPCODE_SET_MEMBER: {
 				text += "set_member ";
 				text += "[\"";
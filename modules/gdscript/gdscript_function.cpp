@@ -104,6 +104,28 @@ void GDScriptFunction::debug_get_stack_member_state(int p_line, List<Pair<String
 	}
 }
 
+Vector<uint8_t> GDScriptFunction::_get_await_stack(uint32_t p_size) {
+	Vector<uint8_t> stack;
+	await_stack_pool_lock.lock();
+	if (!await_stack_pool.is_empty()) {
+		stack = await_stack_pool[await_stack_pool.size() - 1];
+		await_stack_pool.resize(await_stack_pool.size() - 1);
+	}
+	await_stack_pool_lock.unlock();
+	stack.resize(p_size);
+	return stack;
+}
+
+// Must be called once the variants in the stack have been freed.
+void GDScriptFunction::_recycle_await_stack(Vector<uint8_t> &r_stack) {
+	await_stack_pool_lock.lock();
+	if (await_stack_pool.size() < MAX_POOLED_AWAIT_STACKS) {
+		await_stack_pool.push_back(r_stack);
+	}
+	await_stack_pool_lock.unlock();
+	r_stack = Vector<uint8_t>();
+}
+
 GDScriptFunction::GDScriptFunction() {
 	name = "<anonymous>";
 #ifdef DEBUG_ENABLED
@@ -211,9 +233,14 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 		instances_list.remove_from_list();
 	}
 
+	GDScriptFunction *func = function;
+	// Freeing the stack or emitting the signal may release the last reference to the script,
+	// which owns the function and its stack pool.
+	Ref<GDScript> owner_script = func->get_script();
+
 	state.result = p_arg;
 	Callable::CallError err;
-	Variant ret = function->call(nullptr, nullptr, 0, err, &state);
+	Variant ret = func->call(nullptr, nullptr, 0, err, &state);
 
 	bool completed = true;
 
@@ -221,7 +248,7 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 	// then the function did await again after resuming.
 	if (ret.is_ref_counted()) {
 		GDScriptFunctionState *gdfs = Object::cast_to<GDScriptFunctionState>(ret);
-		if (gdfs && gdfs->function == function) {
+		if (gdfs && gdfs->function == func) {
 			completed = false;
 			gdfs->first_state = first_state.is_valid() ? first_state : Ref<GDScriptFunctionState>(this);
 		}
@@ -243,7 +270,11 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 		}
 
 		_clear_stack();
+#else
+		// Release builds already freed the variants when returning from the call.
+		state.stack_size = 0;
 #endif
+		func->_recycle_await_stack(state.stack);
 	}
 
 	return ret;
@@ -251,12 +282,16 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 
 void GDScriptFunctionState::_clear_stack() {
 	if (state.stack_size) {
-		Variant *stack = (Variant *)state.stack.ptr();
+		// Freeing the variants may free this state too (and run this again from the destructor),
+		// so mark the stack as cleared first and keep the buffer alive until done.
+		int stack_size = state.stack_size;
+		state.stack_size = 0;
+		Vector<uint8_t> stack_buffer = state.stack;
+		Variant *stack = (Variant *)stack_buffer.ptr();
 		// The first 3 are special addresses and not copied to the state, so we skip them here.
-		for (int i = 3; i < state.stack_size; i++) {
+		for (int i = 3; i < stack_size; i++) {
 			stack[i].~Variant();
 		}
-		state.stack_size = 0;
 	}
 }
 
@@ -288,4 +323,7 @@ GDScriptFunctionState::~GDScriptFunctionState() {
 		scripts_list.remove_from_list();
 		instances_list.remove_from_list();
 	}
+
+	// The state was never resumed to completion, it still owns the variants of the stack.
+	_clear_stack();
 }
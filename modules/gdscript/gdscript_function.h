@@ -35,8 +35,10 @@
 
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/os/spin_lock.h"
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
@@ -232,6 +234,7 @@ public:
 		OPCODE_SET_NAMED_VALIDATED,
 		OPCODE_GET_NAMED,
 		OPCODE_GET_NAMED_VALIDATED,
+		OPCODE_GET_NAMED_SCRIPT_MEMBER,
 		OPCODE_SET_MEMBER,
 		OPCODE_GET_MEMBER,
 		OPCODE_SET_STATIC_VARIABLE, // Only for GDScript.
@@ -402,6 +405,8 @@ private:
 	friend class GDScriptCompiler;
 	friend class GDScriptByteCodeGenerator;
 	friend class GDScriptLanguage;
+	friend class GDScriptSamplingProfiler;
+	friend class GDScriptFunctionState;
 
 	StringName name;
 	StringName source;
@@ -476,6 +481,17 @@ private:
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
 
+	// Assigned the first time the function runs while GDScriptSamplingProfiler is active.
+	SafeNumeric<uint32_t> sampling_id;
+
+	// Stacks of finished coroutines, reused by the next `await` in this function.
+	static constexpr uint32_t MAX_POOLED_AWAIT_STACKS = 16;
+	SpinLock await_stack_pool_lock;
+	LocalVector<Vector<uint8_t>> await_stack_pool;
+
+	Vector<uint8_t> _get_await_stack(uint32_t p_size);
+	void _recycle_await_stack(Vector<uint8_t> &r_stack);
+
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
 	const char *_func_cname = nullptr;
@@ -0,0 +1,174 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_sampling_profiler.h"
+
+#include "gdscript.h"
+
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+
+thread_local GDScriptSamplingProfiler::ThreadStack GDScriptSamplingProfiler::thread_stack;
+SafeFlag GDScriptSamplingProfiler::running;
+uint32_t GDScriptSamplingProfiler::interval_usec = 1000;
+Thread GDScriptSamplingProfiler::sampler_thread;
+Mutex GDScriptSamplingProfiler::mutex;
+LocalVector<GDScriptSamplingProfiler::ThreadStack *> GDScriptSamplingProfiler::threads;
+LocalVector<String> GDScriptSamplingProfiler::frame_names;
+HashMap<Vector<uint32_t>, uint64_t, GDScriptSamplingProfiler::SampleHasher> GDScriptSamplingProfiler::samples;
+uint64_t GDScriptSamplingProfiler::sample_count = 0;
+
+GDScriptSamplingProfiler::ThreadStack::~ThreadStack() {
+	if (frames) {
+		// The sampler may be reading this thread's frames, wait for it to finish.
+		MutexLock lock(mutex);
+		threads.erase(this);
+		memdelete_arr(frames);
+		frames = nullptr;
+	}
+}
+
+// Ids are indices into frame_names plus one, so zero can mean "not registered".
+// Names are never removed, which keeps ids of functions freed by a script
+// reload valid in the samples taken before it.
+uint32_t GDScriptSamplingProfiler::_add_frame_name(const String &p_name) {
+	frame_names.push_back(p_name);
+	return frame_names.size();
+}
+
+uint32_t GDScriptSamplingProfiler::_register_function(GDScriptFunction *p_function) {
+	MutexLock lock(mutex);
+	uint32_t id = p_function->sampling_id.get();
+	if (id == 0) {
+		id = _add_frame_name(String(p_function->source) + ":" + String(p_function->name));
+		p_function->sampling_id.set(id);
+	}
+	return id;
+}
+
+void GDScriptSamplingProfiler::_register_thread() {
+	ThreadStack &ts = thread_stack;
+	String name = Thread::is_main_thread() ? String("Main Thread") : vformat("Thread %d", (uint64_t)Thread::get_caller_id());
+
+	MutexLock lock(mutex);
+	ts.frames = memnew_arr(std::atomic<uint32_t>, GDScriptFunction::MAX_CALL_DEPTH);
+	ts.name_id = _add_frame_name(name);
+	threads.push_back(&ts);
+}
+
+void GDScriptSamplingProfiler::_take_sample() {
+	MutexLock lock(mutex);
+	Vector<uint32_t> stack;
+	for (ThreadStack *ts : threads) {
+		uint32_t depth = MIN(ts->depth.load(std::memory_order_acquire), (uint32_t)GDScriptFunction::MAX_CALL_DEPTH);
+		if (depth == 0) {
+			continue; // Not running script code.
+		}
+		// The owning thread keeps running while being sampled, so it may pop and
+		// push frames while they are copied. That only skews the sample, each
+		// frame read is a valid id and the memory stays valid until the thread
+		// is unregistered.
+		stack.resize(depth + 1);
+		uint32_t *w = stack.ptrw();
+		w[0] = ts->name_id;
+		for (uint32_t i = 0; i < depth; i++) {
+			w[i + 1] = ts->frames[i].load(std::memory_order_relaxed);
+		}
+
+		uint64_t *count = samples.getptr(stack);
+		if (count) {
+			(*count)++;
+		} else {
+			samples.insert(stack, 1);
+		}
+	}
+	sample_count++;
+}
+
+void GDScriptSamplingProfiler::_sampler_thread_func(void *p_userdata) {
+	while (running.is_set()) {
+		OS::get_singleton()->delay_usec(interval_usec);
+		_take_sample();
+	}
+}
+
+void GDScriptSamplingProfiler::start(int p_frequency) {
+	ERR_FAIL_COND_MSG(running.is_set(), "The GDScript sampling profiler is already running.");
+	ERR_FAIL_COND(p_frequency <= 0);
+
+	{
+		MutexLock lock(mutex);
+		samples.clear();
+		sample_count = 0;
+	}
+
+	interval_usec = MAX(1000000 / p_frequency, 1);
+	running.set();
+	sampler_thread.start(_sampler_thread_func, nullptr);
+}
+
+void GDScriptSamplingProfiler::stop() {
+	if (!running.is_set()) {
+		return;
+	}
+	running.clear();
+	sampler_thread.wait_to_finish();
+}
+
+uint64_t GDScriptSamplingProfiler::get_sample_count() {
+	MutexLock lock(mutex);
+	return sample_count;
+}
+
+// One line per unique stack, outermost frame first, followed by the number
+// of samples in which it was seen (e.g. "Main Thread;res://a.gd:_process 12").
+String GDScriptSamplingProfiler::get_collapsed_stacks() {
+	MutexLock lock(mutex);
+	String result;
+	for (const KeyValue<Vector<uint32_t>, uint64_t> &E : samples) {
+		String line;
+		for (int i = 0; i < E.key.size(); i++) {
+			if (i > 0) {
+				line += ";";
+			}
+			line += frame_names[E.key[i] - 1];
+		}
+		result += line + " " + itos(E.value) + "\n";
+	}
+	return result;
+}
+
+Error GDScriptSamplingProfiler::save_collapsed_stacks(const String &p_path) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, vformat("Cannot open file '%s' to save GDScript profiler samples.", p_path));
+	f->store_string(get_collapsed_stacks());
+	return OK;
+}
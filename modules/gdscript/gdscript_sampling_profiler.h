@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GDSCRIPT_SAMPLING_PROFILER_H
+#define GDSCRIPT_SAMPLING_PROFILER_H
+
+#include "gdscript_function.h"
+
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+#include <atomic>
+
+// Statistical profiler for GDScript. Unlike the instrumenting profiler in
+// GDScriptLanguage, it does not time every call: while it is running, each
+// thread executing script code only records the ids of the functions on its
+// stack, and a background thread periodically copies those stacks.
+// The result can be exported as collapsed stacks, as used by flame graph tools.
+class GDScriptSamplingProfiler {
+	// Written only by its thread and read by the sampler while that thread runs.
+	// A frame is stored before the depth that includes it is published with
+	// release ordering, so the sampler sees it after loading the depth with acquire.
+	struct ThreadStack {
+		std::atomic<uint32_t> *frames = nullptr;
+		std::atomic<uint32_t> depth = 0;
+		uint32_t name_id = 0;
+
+		~ThreadStack();
+	};
+
+	struct SampleHasher {
+		static _FORCE_INLINE_ uint32_t hash(const Vector<uint32_t> &p_stack) {
+			return hash_murmur3_buffer(p_stack.ptr(), p_stack.size() * sizeof(uint32_t));
+		}
+	};
+
+	static thread_local ThreadStack thread_stack;
+	static SafeFlag running;
+	static uint32_t interval_usec;
+	static Thread sampler_thread;
+
+	// Guards everything below.
+	static Mutex mutex;
+	static LocalVector<ThreadStack *> threads;
+	static LocalVector<String> frame_names;
+	static HashMap<Vector<uint32_t>, uint64_t, SampleHasher> samples;
+	static uint64_t sample_count;
+
+	static uint32_t _add_frame_name(const String &p_name);
+	static uint32_t _register_function(GDScriptFunction *p_function);
+	static void _register_thread();
+	static void _take_sample();
+	static void _sampler_thread_func(void *p_userdata);
+
+	static _FORCE_INLINE_ void _push(GDScriptFunction *p_function) {
+		uint32_t id = p_function->sampling_id.get();
+		if (unlikely(id == 0)) {
+			id = _register_function(p_function);
+		}
+		ThreadStack &ts = thread_stack;
+		if (unlikely(ts.frames == nullptr)) {
+			_register_thread();
+		}
+		uint32_t depth = ts.depth.load(std::memory_order_relaxed);
+		if (likely(depth < (uint32_t)GDScriptFunction::MAX_CALL_DEPTH)) {
+			ts.frames[depth].store(id, std::memory_order_relaxed);
+		}
+		ts.depth.store(depth + 1, std::memory_order_release);
+	}
+
+	static _FORCE_INLINE_ void _pop() {
+		ThreadStack &ts = thread_stack;
+		ts.depth.store(ts.depth.load(std::memory_order_relaxed) - 1, std::memory_order_release);
+	}
+
+public:
+	// Pushes the function on the sampled stack of the current thread for the
+	// duration of the scope, only if the profiler was running when entering it.
+	class CallScope {
+		bool pushed = false;
+
+	public:
+		_FORCE_INLINE_ CallScope(GDScriptFunction *p_function) {
+			if (unlikely(running.is_set())) {
+				_push(p_function);
+				pushed = true;
+			}
+		}
+
+		_FORCE_INLINE_ ~CallScope() {
+			if (unlikely(pushed)) {
+				_pop();
+			}
+		}
+	};
+
+	static _FORCE_INLINE_ bool is_running() { return running.is_set(); }
+
+	static void start(int p_frequency);
+	static void stop();
+	static uint64_t get_sample_count();
+	static String get_collapsed_stacks();
+	static Error save_collapsed_stacks(const String &p_path);
+};
+
+#endif // GDSCRIPT_SAMPLING_PROFILER_H
@@ -31,6 +31,7 @@
 #include "gdscript.h"
 #include "gdscript_function.h"
 #include "gdscript_lambda_callable.h"
+#include "gdscript_sampling_profiler.h"
 
 #include "core/os/os.h"
 
@@ -229,6 +230,7 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_SET_NAMED_VALIDATED,                    \
 		&&OPCODE_GET_NAMED,                              \
 		&&OPCODE_GET_NAMED_VALIDATED,                    \
+		&&OPCODE_GET_NAMED_SCRIPT_MEMBER,                \
 		&&OPCODE_SET_MEMBER,                             \
 		&&OPCODE_GET_MEMBER,                             \
 		&&OPCODE_SET_STATIC_VARIABLE,                    \
@@ -582,7 +584,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 	memnew_placement(&stack[ADDR_STACK_CLASS], Variant(script));
 	memnew_placement(&stack[ADDR_STACK_NIL], Variant);
 
+	GDScriptSamplingProfiler::CallScope sampling_scope(this);
+
 	String err_text;
+	bool stack_moved = false;
 
 #ifdef DEBUG_ENABLED
 
@@ -1189,6 +1194,66 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_GET_NAMED_SCRIPT_MEMBER) {
+				CHECK_SPACE(6);
+
+				GET_VARIANT_PTR(src, 0);
+				GET_VARIANT_PTR(dst, 1);
+				GET_VARIANT_PTR(type, 2);
+
+				int indexname = _code_ptr[ip + 4];
+				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
+				const StringName *index = &_global_names_ptr[indexname];
+				int member_index = _code_ptr[ip + 5];
+
+				// Instances of the expected script, or of a script inheriting from it, store the member at the same index.
+				const GDScriptInstance *member_owner = nullptr;
+				if (src->get_type() == Variant::OBJECT) {
+					Object *obj = src->get_validated_object();
+					ScriptInstance *scr_inst = obj ? obj->get_script_instance() : nullptr;
+					if (scr_inst && !scr_inst->is_placeholder() && scr_inst->get_language() == GDScriptLanguage::get_singleton()) {
+						const GDScript *expected_type = static_cast<GDScript *>(type->operator Object *());
+						const GDScriptInstance *gd_inst = static_cast<const GDScriptInstance *>(scr_inst);
+						for (const GDScript *scr = gd_inst->script.ptr(); scr; scr = scr->_base) {
+							if (scr == expected_type) {
+								member_owner = gd_inst;
+								break;
+							}
+						}
+					}
+				}
+
+#ifdef DEBUG_ENABLED
+				// Scripts can be reloaded with a different layout while this function still uses the old one.
+				if (member_owner) {
+					const GDScript::MemberInfo *member_info = member_owner->script->member_indices.getptr(*index);
+					if (!member_info || member_info->index != member_index || member_info->getter != StringName()) {
+						member_owner = nullptr;
+					}
+				}
+#endif
+
+				if (member_owner && member_owner->script->valid && member_index < member_owner->members.size()) {
+					// Copy first, `dst` may be the only reference to the instance.
+					Variant ret = member_owner->members[member_index];
+					*dst = ret;
+				} else {
+					bool valid;
+#ifdef DEBUG_ENABLED
+					Variant ret = src->get_named(*index, valid);
+					if (!valid) {
+						err_text = "Invalid access to property or key '" + index->operator String() + "' on a base object of type '" + _get_var_type(src) + "'.";
+						OPCODE_BREAK;
+					}
+					*dst = ret;
+#else
+					*dst = src->get_named(*index, valid);
+#endif
+				}
+				ip += 6;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_SET_MEMBER) {
 				CHECK_SPACE(3);
 				GET_VARIANT_PTR(src, 0);
@@ -2378,12 +2443,18 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					Ref<GDScriptFunctionState> gdfs = memnew(GDScriptFunctionState);
 					gdfs->function = this;
 
-					gdfs->state.stack.resize(alloca_size);
-
-					// First 3 stack addresses are special, so we just skip them here.
-					for (int i = 3; i < _stack_size; i++) {
-						memnew_placement(&gdfs->state.stack.write[sizeof(Variant) * i], Variant(stack[i]));
+					if (p_state) {
+						// Already running from the stack of a previous await, hand it over as is.
+						gdfs->state.stack = p_state->stack;
+						p_state->stack = Vector<uint8_t>();
+						p_state->stack_size = 0;
+					} else {
+						// Variants are relocatable, so move them out of the alloca stack
+						// instead of copying. First 3 stack addresses are special, so we just skip them here.
+						gdfs->state.stack = _get_await_stack(alloca_size);
+						memcpy(gdfs->state.stack.ptrw() + sizeof(Variant) * 3, (const void *)&stack[3], sizeof(Variant) * (_stack_size - 3));
 					}
+					stack_moved = true;
 					gdfs->state.stack_size = _stack_size;
 					gdfs->state.alloca_size = alloca_size;
 					gdfs->state.ip = ip + 2;
@@ -2871,7 +2942,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				Vector2i *bounds = VariantInternal::get_vector2i(container);
 
-				VariantInternal::initialize(counter, Variant::FLOAT);
+				VariantInternal::initialize(counter, Variant::INT);
 				*VariantInternal::get_int(counter) = bounds->x;
 
 				if (bounds->x < bounds->y) {
@@ -3384,7 +3455,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			ip = jumpto;                                                                            \
 		} else {                                                                                    \
 			GET_VARIANT_PTR(iterator, 2);                                                           \
-			*VariantInternal::m_ret_get_func(iterator) = array->get(*idx);                          \
+			*VariantInternal::m_ret_get_func(iterator) = array->ptr()[*idx];                        \
 			ip += 5;                                                                                \
 		}                                                                                           \
 	}                                                                                               \
@@ -3680,9 +3751,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		}
 #endif
 
-		// Free stack, except reserved addresses.
-		for (int i = FIXED_ADDRESSES_MAX; i < _stack_size; i++) {
-			stack[i].~Variant();
+		// Free stack, except reserved addresses, unless it was moved to an awaiting function state.
+		if (!stack_moved) {
+			for (int i = FIXED_ADDRESSES_MAX; i < _stack_size; i++) {
+				stack[i].~Variant();
+			}
 		}
 #ifdef DEBUG_ENABLED
 	}
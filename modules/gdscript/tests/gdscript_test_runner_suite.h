@@ -33,6 +33,8 @@
 
 #include "gdscript_test_runner.h"
 
+#include "../gdscript_sampling_profiler.h"
+
 #include "tests/test_macros.h"
 
 namespace GDScriptTests {
@@ -70,6 +72,48 @@ func _init():
 	ref_counted->set_script(gdscript);
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
+
+TEST_CASE("[Modules][GDScript] Sampling profiler records running functions") {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(R"(
+extends RefCounted
+
+func spin(msec):
+	var end = Time.get_ticks_msec() + msec
+	while Time.get_ticks_msec() < end:
+		pass
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE(error == OK);
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(gdscript);
+
+	REQUIRE_FALSE(GDScriptSamplingProfiler::is_running());
+	GDScriptSamplingProfiler::start(1000);
+	CHECK(GDScriptSamplingProfiler::is_running());
+
+	// Keep the script busy until the sampler caught it, the sampler thread may be slow to start.
+	const uint64_t timeout = OS::get_singleton()->get_ticks_msec() + 5000;
+	while (!GDScriptSamplingProfiler::get_collapsed_stacks().contains(":spin") && OS::get_singleton()->get_ticks_msec() < timeout) {
+		ref_counted->call("spin", 20);
+	}
+
+	GDScriptSamplingProfiler::stop();
+	CHECK_FALSE(GDScriptSamplingProfiler::is_running());
+	CHECK(GDScriptSamplingProfiler::get_sample_count() > 0);
+
+	const String stacks = GDScriptSamplingProfiler::get_collapsed_stacks();
+	CHECK_MESSAGE(stacks.contains("Main Thread;"), "Stacks should start with the name of the sampled thread.");
+	CHECK_MESSAGE(stacks.contains(":spin "), "The running script function should be in the sampled stacks.");
+
+	// Nothing is sampled once stopped.
+	const uint64_t sample_count = GDScriptSamplingProfiler::get_sample_count();
+	ref_counted->call("spin", 20);
+	CHECK(GDScriptSamplingProfiler::get_sample_count() == sample_count);
+}
 #endif // TOOLS_ENABLED
 
 TEST_CASE("[Modules][GDScript] Validate built-in API") {
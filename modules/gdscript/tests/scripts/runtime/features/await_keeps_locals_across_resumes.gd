@@ -0,0 +1,21 @@
+signal step
+
+func counter(id: int) -> Array:
+	var values := []
+	var total := 0
+	for i in 3:
+		var value = await step
+		total += value
+		values.append(value)
+	return [id, total, values]
+
+func worker(id: int):
+	var result = await counter(id)
+	print(result)
+
+func test():
+	for batch in 2:
+		worker(batch * 2)
+		worker(batch * 2 + 1)
+		for i in 3:
+			step.emit(i + 1)
@@ -0,0 +1,41 @@
+const ENABLED = true
+const DISABLED = false
+
+func pick(value: int) -> String:
+	if DISABLED:
+		return "disabled"
+	elif value > 0:
+		return "positive"
+	if ENABLED:
+		if value == 0:
+			return "zero"
+	else:
+		return "not enabled"
+	return "negative"
+
+func classify(values: Array) -> Array:
+	var result := []
+	for value in values:
+		if value % 2 == 0:
+			if value == 0:
+				continue
+			result.append("even")
+		else:
+			result.append("odd")
+	return result
+
+func count_until(limit: int) -> int:
+	var i := 0
+	while true:
+		if i < limit:
+			i += 1
+		else:
+			break
+	return i
+
+func test():
+	print(pick(1))
+	print(pick(0))
+	print(pick(-1))
+	print(classify([0, 1, 2, 3]))
+	print(count_until(5))
@@ -0,0 +1,36 @@
+class Record:
+	var id := 0
+	var label := ""
+	var with_getter := 1:
+		get:
+			return with_getter * 10
+
+class ExtendedRecord extends Record:
+	var extra := 5
+
+func make(id: int) -> Record:
+	var record := Record.new()
+	record.id = id
+	record.label = "record %d" % id
+	return record
+
+func test():
+	var record: Record = make(1)
+	print(record.id)
+	print(record.label)
+	print(record.with_getter)
+
+	# Instances of subclasses keep the base member layout.
+	var extended: Record = ExtendedRecord.new()
+	extended.id = 2
+	print(extended.id)
+	print((extended as ExtendedRecord).extra)
+
+	# The typed base may be the only reference to the instance.
+	print(make(3).label)
+
+	var records: Array[Record] = [make(4), make(5)]
+	var total := 0
+	for r in records:
+		total += r.id
+	print(total)
@@ -0,0 +1,37 @@
+func test():
+	var scene_script := GDScript.new()
+	scene_script.source_code = '''
+extends Node
+
+@export var exported_value := 1
+var plain_value := 2
+var plain_array := [1]
+var init_count := 0
+
+func _init() -> void:
+	init_count += 1
+'''
+	@warning_ignore("return_value_discarded")
+	scene_script.reload()
+
+	var node := Node.new()
+	node.set_script(scene_script)
+	var packed := PackedScene.new()
+	@warning_ignore("return_value_discarded")
+	packed.pack(node)
+	node.free()
+
+	var instance := packed.acquire_instance()
+	instance.set("exported_value", 10)
+	instance.set("plain_value", 20)
+	@warning_ignore("unsafe_method_access")
+	instance.get("plain_array").push_back(2)
+	packed.release_instance(instance)
+
+	var reused := packed.acquire_instance()
+	print(reused == instance)
+	print(reused.get("exported_value"))
+	print(reused.get("plain_value"))
+	print(reused.get("plain_array"))
+	print(reused.get("init_count"))
+	reused.free()
@@ -0,0 +1,55 @@
+func test():
+	var from := 2
+	var to := 6
+	var count := 3
+
+	var result := []
+	for i in range(count):
+		result.push_back(i)
+	print(result)
+
+	result.clear()
+	for i in range(from, to):
+		result.push_back(i)
+	print(result)
+
+	result.clear()
+	for i in range(to, from, -2):
+		result.push_back(i)
+	print(result)
+
+	# The bounds are evaluated once, before the loop.
+	result.clear()
+	for i in range(from, to + 1, 2):
+		to = 0
+		result.push_back(i)
+	print(result)
+
+	result.clear()
+	for i in range(-count):
+		result.push_back(i)
+	print(result)
+
+	result.clear()
+	for i in range(0, count):
+		result.push_back(i)
+	print(result)
+
+	# Bounds and steps outside of the 32-bit range.
+	var big := 1 << 40
+	result.clear()
+	for i in range(big, big + 3):
+		result.push_back(i - big)
+	print(result)
+
+	result.clear()
+	for i in range(0, big * 4, big):
+		result.push_back(i >> 40)
+	print(result)
+
+	for i in range(from, from):
+		print("Empty range should not iterate.")
+
+	for number in range(count):
+		if typeof(number) != TYPE_INT:
+			print("Number returned from `range` was not an int!")
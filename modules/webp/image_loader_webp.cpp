@@ -54,6 +54,10 @@ Error ImageLoaderWebP::load_image(Ref<Image> p_image, Ref<FileAccess> f, BitFiel
 	Vector<uint8_t> src_image;
 	uint64_t src_image_len = f->get_length();
 	ERR_FAIL_COND_V(src_image_len == 0, ERR_FILE_CORRUPT);
+	const uint8_t *view = f->get_buffer_view(src_image_len);
+	if (view) {
+		return WebPCommon::webp_load_image_from_buffer(p_image.ptr(), view, src_image_len);
+	}
 	src_image.resize(src_image_len);
 
 	uint8_t *w = src_image.ptrw();
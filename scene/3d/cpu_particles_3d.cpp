@@ -1207,25 +1207,24 @@ void CPUParticles3D::_update_particle_data_buffer() {
 	for (int i = 0; i < pc; i++) {
 		int idx = order ? order[i] : i;
 
-		Transform3D t = r[idx].transform;
-
-		if (!local_coords) {
-			t = inv_emission_transform * t;
-		}
-
 		if (r[idx].active) {
-			ptr[0] = t.basis.rows[0][0];
-			ptr[1] = t.basis.rows[0][1];
-			ptr[2] = t.basis.rows[0][2];
-			ptr[3] = t.origin.x;
-			ptr[4] = t.basis.rows[1][0];
-			ptr[5] = t.basis.rows[1][1];
-			ptr[6] = t.basis.rows[1][2];
-			ptr[7] = t.origin.y;
-			ptr[8] = t.basis.rows[2][0];
-			ptr[9] = t.basis.rows[2][1];
-			ptr[10] = t.basis.rows[2][2];
-			ptr[11] = t.origin.z;
+			if (!local_coords) {
+				inv_emission_transform.mult_store_3x4(r[idx].transform, ptr);
+			} else {
+				const Transform3D &t = r[idx].transform;
+				ptr[0] = t.basis.rows[0][0];
+				ptr[1] = t.basis.rows[0][1];
+				ptr[2] = t.basis.rows[0][2];
+				ptr[3] = t.origin.x;
+				ptr[4] = t.basis.rows[1][0];
+				ptr[5] = t.basis.rows[1][1];
+				ptr[6] = t.basis.rows[1][2];
+				ptr[7] = t.origin.y;
+				ptr[8] = t.basis.rows[2][0];
+				ptr[9] = t.basis.rows[2][1];
+				ptr[10] = t.basis.rows[2][2];
+				ptr[11] = t.origin.z;
+			}
 		} else {
 			memset(ptr, 0, sizeof(float) * 12);
 		}
@@ -1317,21 +1316,8 @@ void CPUParticles3D::_notification(int p_what) {
 				float *ptr = w;
 
 				for (int i = 0; i < pc; i++) {
-					Transform3D t = inv_emission_transform * r[i].transform;
-
 					if (r[i].active) {
-						ptr[0] = t.basis.rows[0][0];
-						ptr[1] = t.basis.rows[0][1];
-						ptr[2] = t.basis.rows[0][2];
-						ptr[3] = t.origin.x;
-						ptr[4] = t.basis.rows[1][0];
-						ptr[5] = t.basis.rows[1][1];
-						ptr[6] = t.basis.rows[1][2];
-						ptr[7] = t.origin.y;
-						ptr[8] = t.basis.rows[2][0];
-						ptr[9] = t.basis.rows[2][1];
-						ptr[10] = t.basis.rows[2][2];
-						ptr[11] = t.origin.z;
+						inv_emission_transform.mult_store_3x4(r[i].transform, ptr);
 					} else {
 						memset(ptr, 0, sizeof(float) * 12);
 					}
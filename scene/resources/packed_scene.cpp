@@ -124,6 +124,211 @@ Ref<Resource> SceneState::get_remap_resource(const Ref<Resource> &p_resource, Ha
 	return remap_resource;
 }
 
+void SceneState::_update_cached_setters() const {
+	MutexLock lock(cache_mutex);
+	if (cached_setters_valid.is_set()) {
+		return;
+	}
+
+	cached_setter_offsets.clear();
+	cached_setters.clear();
+
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type == TYPE_INSTANTIATED || n.type < 0 || n.type >= names.size()) {
+			cached_setter_offsets.push_back(-1);
+			continue;
+		}
+
+		cached_setter_offsets.push_back(cached_setters.size());
+		const StringName &type = names[n.type];
+		for (const NodeData::Property &prop : n.properties) {
+			CachedSetter cs;
+			if (!(prop.name & FLAG_PATH_PROPERTY_IS_NODE) && prop.name >= 0 && prop.name < names.size() && names[prop.name] != CoreStringName(script)) {
+				cs.setter = ClassDB::get_property_setter_bind(type, names[prop.name], &cs.index);
+			}
+			cached_setters.push_back(cs);
+		}
+	}
+
+	cached_setters_valid.set();
+}
+
+void SceneState::_update_pool_data() const {
+	MutexLock lock(cache_mutex);
+	if (pool_data_valid.is_set()) {
+		return;
+	}
+
+	pool_nodes.clear();
+	poolable = !nodes.is_empty() && base_scene_idx < 0;
+
+	for (int i = 0; poolable && i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		if (n.instance >= 0 || n.type == TYPE_INSTANTIATED || n.type < 0 || n.type >= names.size() || (i > 0 && (n.parent & FLAG_ID_IS_PATH))) {
+			// Nested instances have their own state, which is not tracked here.
+			poolable = false;
+			break;
+		}
+
+		PoolNodeData pnd;
+		pnd.path = get_node_path(i);
+
+		HashSet<StringName> stored;
+		for (const NodeData::Property &prop : n.properties) {
+			const Variant &value = variants[prop.value];
+			if (value.get_type() == Variant::OBJECT) {
+				Ref<Resource> res = value;
+				poolable = poolable && !(res.is_valid() && res->is_local_to_scene());
+			} else if (value.get_type() == Variant::ARRAY) {
+				poolable = poolable && !has_local_resource(value);
+			} else if (value.get_type() == Variant::DICTIONARY) {
+				Dictionary dict = value;
+				poolable = poolable && !has_local_resource(dict.keys()) && !has_local_resource(dict.values());
+			}
+			stored.insert(names[prop.name & FLAG_PROP_NAME_MASK]);
+		}
+
+		const StringName &type = names[n.type];
+		List<PropertyInfo> plist;
+		ClassDB::get_property_list(type, &plist);
+		for (const PropertyInfo &pi : plist) {
+			if (!(pi.usage & PROPERTY_USAGE_STORAGE) || pi.name == CoreStringName(script) || stored.has(pi.name)) {
+				continue;
+			}
+
+			bool valid = false;
+			Variant value = ClassDB::class_get_default_property_value(type, pi.name, &valid);
+			if (!valid || (value.get_type() == Variant::OBJECT && value.get_validated_object())) {
+				// Objects created by the constructor belong to each node, so they are left alone.
+				continue;
+			}
+			pnd.defaults.push_back(Pair<StringName, Variant>(pi.name, value));
+		}
+
+		for (int j = i + 1; j < nodes.size(); j++) {
+			if (nodes[j].parent == i) {
+				pnd.child_count++;
+			}
+		}
+
+		pool_nodes.push_back(pnd);
+	}
+
+	pool_data_valid.set();
+}
+
+void SceneState::_clear_caches() {
+	if (!cached_setters_valid.is_set() && !pool_data_valid.is_set()) {
+		return;
+	}
+
+	MutexLock lock(cache_mutex);
+	cached_setters_valid.clear();
+	cached_setter_offsets.clear();
+	cached_setters.clear();
+	pool_data_valid.clear();
+	pool_nodes.clear();
+}
+
+bool SceneState::reset_instance(Node *p_root) const {
+	ERR_FAIL_NULL_V(p_root, false);
+
+	if (!pool_data_valid.is_set()) {
+		_update_pool_data();
+	}
+	if (!poolable) {
+		return false;
+	}
+
+	int nc = nodes.size();
+	Node **targets = (Node **)alloca(sizeof(Node *) * nc);
+	for (int i = 0; i < nc; i++) {
+		// Nodes that were added, removed or renamed since instantiation make the instance unusable.
+		Node *node = i == 0 ? p_root : p_root->get_node_or_null(pool_nodes[i].path);
+		if (!node || node->get_class_name() != names[nodes[i].type] || node->get_child_count(false) != pool_nodes[i].child_count) {
+			return false;
+		}
+		if (node->get_script_instance() && node->get_script_instance()->is_placeholder()) {
+			// Placeholders (scripts not running in the editor) can't be recreated from the script.
+			return false;
+		}
+		targets[i] = node;
+	}
+
+	// The root may have been renamed to avoid a clash when it was added to the tree.
+	p_root->_set_name_nocheck(names[nodes[0].name]);
+
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+		Node *node = targets[i];
+
+		// Groups stored in the scene are persistent, others were joined at runtime.
+		List<Node::GroupInfo> groups;
+		node->get_groups(&groups);
+		for (const Node::GroupInfo &gi : groups) {
+			if (!gi.persistent) {
+				node->remove_from_group(gi.name);
+			}
+		}
+
+		ScriptInstance *si = node->get_script_instance();
+		if (si) {
+			// A new script instance runs the member initializers and _init() again, as on instantiation.
+			// Scene-stored values for script variables are re-applied below with the other properties.
+			Ref<Script> node_script = si->get_script();
+			node->set_script_instance(node_script->instance_create(node));
+			if (!node->get_script_instance()) {
+				return false;
+			}
+		}
+
+		for (const Pair<StringName, Variant> &E : pool_nodes[i].defaults) {
+			node->set(E.first, E.second.duplicate());
+		}
+
+		for (const NodeData::Property &prop : n.properties) {
+			const StringName &name = names[prop.name & FLAG_PROP_NAME_MASK];
+			const Variant &value = variants[prop.value];
+
+			if (prop.name & FLAG_PATH_PROPERTY_IS_NODE) {
+				if (value.get_type() == Variant::ARRAY) {
+					Array paths = value;
+					bool valid;
+					Array array = node->get(name, &valid);
+					ERR_CONTINUE(!valid);
+					array = array.duplicate();
+					array.resize(paths.size());
+					for (int j = 0; j < array.size(); j++) {
+						array.set(j, node->get_node_or_null(paths[j]));
+					}
+					node->set(name, array);
+				} else {
+					node->set(name, node->get_node_or_null(value));
+				}
+			} else if (value.get_type() == Variant::ARRAY) {
+				Array set_array = value;
+				bool valid = false;
+				Variant get_value = node->get(name, &valid);
+				if (valid && get_value.get_type() == Variant::ARRAY) {
+					Array get_array = get_value;
+					if (!set_array.is_same_typed(get_array)) {
+						set_array = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
+					}
+				}
+				node->set(name, set_array);
+			} else if (name != CoreStringName(script)) {
+				node->set(name, value);
+			}
+		}
+
+		// So _ready() runs again the next time the instance enters the tree.
+		node->request_ready();
+	}
+
+	return true;
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -165,6 +370,12 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
 
+	// The editor relies on Object::set() to track edits, so only plain instantiation takes the shortcut.
+	bool use_cached_setters = p_edit_state == GEN_EDIT_STATE_DISABLED;
+	if (use_cached_setters && !cached_setters_valid.is_set()) {
+		_update_cached_setters();
+	}
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
 
@@ -191,6 +402,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 		Node *node = nullptr;
 		MissingNode *missing_node = nullptr;
 		bool is_inherited_scene = false;
+		const CachedSetter *setters = nullptr;
 
 		if (i == 0 && base_scene_idx >= 0) {
 			// Scene inheritance on root node.
@@ -261,6 +473,10 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 			node = Object::cast_to<Node>(obj);
 
+			if (node && use_cached_setters && cached_setter_offsets[i] >= 0 && node->get_class_name() == snames[n.type]) {
+				setters = &cached_setters[cached_setter_offsets[i]];
+			}
+
 			if (!node) {
 				if (obj) {
 					memdelete(obj);
@@ -405,7 +621,20 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							if (setters && setters[j].setter && !node->get_script_instance()) {
+								// Same call ClassDB::set_property() ends up making, without the lookup.
+								Callable::CallError ce;
+								if (setters[j].index >= 0) {
+									Variant index = setters[j].index;
+									const Variant *args[2] = { &index, &value };
+									setters[j].setter->call(node, args, 2, ce);
+								} else {
+									const Variant *args[1] = { &value };
+									setters[j].setter->call(node, args, 1, ce);
+								}
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 						if (p_edit_state == GEN_EDIT_STATE_INSTANCE && value.get_type() != Variant::OBJECT) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor.
@@ -1205,6 +1434,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_caches();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1415,6 +1645,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	ERR_FAIL_COND(!p_dictionary.has("conns"));
 	//ERR_FAIL_COND( !p_dictionary.has("path"));
 
+	_clear_caches();
+
 	int version = 1;
 	if (p_dictionary.has("version")) {
 		version = p_dictionary["version"];
@@ -1873,6 +2105,7 @@ Vector<NodePath> SceneState::get_editable_instances() const {
 //add
 
 int SceneState::add_name(const StringName &p_name) {
+	_clear_caches();
 	names.push_back(p_name);
 	return names.size() - 1;
 }
@@ -1896,6 +2129,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.instance = p_instance;
 	nd.index = p_index;
 
+	_clear_caches();
 	nodes.push_back(nd);
 
 	return nodes.size() - 1;
@@ -1912,6 +2146,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 		prop.name |= FLAG_PATH_PROPERTY_IS_NODE;
 	}
 	prop.value = p_value;
+	_clear_caches();
 	nodes.write[p_node].properties.push_back(prop);
 }
 
@@ -1923,6 +2158,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
+	_clear_caches();
 	base_scene_idx = p_idx;
 }
 
@@ -2034,6 +2270,7 @@ SceneState::SceneState() {
 ////////////////
 
 void PackedScene::_set_bundled_scene(const Dictionary &p_scene) {
+	clear_instance_pool();
 	state->set_bundled_scene(p_scene);
 }
 
@@ -2042,10 +2279,12 @@ Dictionary PackedScene::_get_bundled_scene() const {
 }
 
 Error PackedScene::pack(Node *p_scene) {
+	clear_instance_pool();
 	return state->pack(p_scene);
 }
 
 void PackedScene::clear() {
+	clear_instance_pool();
 	state->clear();
 }
 
@@ -2060,6 +2299,8 @@ void PackedScene::reload_from_file() {
 		return;
 	}
 
+	clear_instance_pool();
+
 	// Backup the loaded_state
 	Ref<SceneState> loaded_state = s->get_state();
 	// This assigns a new state to s->state
@@ -2098,7 +2339,87 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	return s;
 }
 
+Node *PackedScene::acquire_instance() {
+	{
+		MutexLock lock(pool_mutex);
+		while (!instance_pool.is_empty()) {
+			ObjectID id = instance_pool[instance_pool.size() - 1];
+			instance_pool.resize(instance_pool.size() - 1);
+
+			// The instance may have been freed by someone else while pooled.
+			Node *node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+			if (node && !node->is_queued_for_deletion()) {
+				return node;
+			}
+		}
+	}
+
+	return instantiate();
+}
+
+void PackedScene::release_instance(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	ERR_FAIL_COND_MSG(p_node->is_queued_for_deletion(), "Can't release an instance that is queued for deletion.");
+
+	if (p_node->get_parent()) {
+		p_node->get_parent()->remove_child(p_node);
+	}
+
+	// Resetting runs setters and scripts, so it's done without holding the lock.
+	bool pooled = get_pooled_instance_count() < max_pooled_instances && state->reset_instance(p_node);
+	if (pooled) {
+		MutexLock lock(pool_mutex);
+		if ((int)instance_pool.size() < max_pooled_instances) {
+			instance_pool.push_back(p_node->get_instance_id());
+		} else {
+			pooled = false;
+		}
+	}
+
+	if (!pooled) {
+		if (SceneTree::get_singleton()) {
+			p_node->queue_free();
+		} else {
+			memdelete(p_node);
+		}
+	}
+}
+
+void PackedScene::clear_instance_pool() {
+	MutexLock lock(pool_mutex);
+	for (const ObjectID &id : instance_pool) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+		if (node) {
+			memdelete(node);
+		}
+	}
+	instance_pool.clear();
+}
+
+int PackedScene::get_pooled_instance_count() const {
+	MutexLock lock(pool_mutex);
+	return instance_pool.size();
+}
+
+void PackedScene::set_max_pooled_instances(int p_max) {
+	ERR_FAIL_COND(p_max < 0);
+	MutexLock lock(pool_mutex);
+	max_pooled_instances = p_max;
+	while ((int)instance_pool.size() > max_pooled_instances) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(instance_pool[instance_pool.size() - 1]));
+		if (node) {
+			memdelete(node);
+		}
+		instance_pool.resize(instance_pool.size() - 1);
+	}
+}
+
+int PackedScene::get_max_pooled_instances() const {
+	return max_pooled_instances;
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
+	clear_instance_pool();
 	state = p_by;
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -2107,6 +2428,7 @@ void PackedScene::replace_state(Ref<SceneState> p_by) {
 }
 
 void PackedScene::recreate_state() {
+	clear_instance_pool();
 	state = Ref<SceneState>(memnew(SceneState));
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -2138,8 +2460,15 @@ void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
 	ClassDB::bind_method(D_METHOD("get_state"), &PackedScene::get_state);
+	ClassDB::bind_method(D_METHOD("acquire_instance"), &PackedScene::acquire_instance);
+	ClassDB::bind_method(D_METHOD("release_instance", "node"), &PackedScene::release_instance);
+	ClassDB::bind_method(D_METHOD("clear_instance_pool"), &PackedScene::clear_instance_pool);
+	ClassDB::bind_method(D_METHOD("get_pooled_instance_count"), &PackedScene::get_pooled_instance_count);
+	ClassDB::bind_method(D_METHOD("set_max_pooled_instances", "max"), &PackedScene::set_max_pooled_instances);
+	ClassDB::bind_method(D_METHOD("get_max_pooled_instances"), &PackedScene::get_max_pooled_instances);
 
 	ADD_PROPERTY(PropertyInfo(Variant::DICTIONARY, "_bundled"), "_set_bundled_scene", "_get_bundled_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_pooled_instances", PROPERTY_HINT_RANGE, "0,1024,1,or_greater", PROPERTY_USAGE_NONE), "set_max_pooled_instances", "get_max_pooled_instances");
 
 	BIND_ENUM_CONSTANT(GEN_EDIT_STATE_DISABLED);
 	BIND_ENUM_CONSTANT(GEN_EDIT_STATE_INSTANCE);
@@ -2150,3 +2479,7 @@ void PackedScene::_bind_methods() {
 PackedScene::PackedScene() {
 	state = Ref<SceneState>(memnew(SceneState));
 }
+
+PackedScene::~PackedScene() {
+	clear_instance_pool();
+}
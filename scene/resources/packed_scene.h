@@ -32,6 +32,10 @@
 #define PACKED_SCENE_H
 
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -89,6 +93,34 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Property setters resolved once for nodes created from a class name, so instantiating
+	// the scene again does not have to look every property up through Object::set().
+	struct CachedSetter {
+		MethodBind *setter = nullptr;
+		int index = -1;
+	};
+
+	mutable LocalVector<int> cached_setter_offsets; // Per node, -1 when the node is not created from a class.
+	mutable LocalVector<CachedSetter> cached_setters;
+	mutable SafeFlag cached_setters_valid;
+
+	// What reset_instance() needs to bring a used instance back to the state it was created in.
+	struct PoolNodeData {
+		NodePath path;
+		int child_count = 0;
+		LocalVector<Pair<StringName, Variant>> defaults; // Properties not stored in the scene, with their class defaults.
+	};
+
+	mutable LocalVector<PoolNodeData> pool_nodes;
+	mutable bool poolable = false;
+	mutable SafeFlag pool_data_valid;
+
+	mutable Mutex cache_mutex;
+
+	void _update_cached_setters() const;
+	void _update_pool_data() const;
+	void _clear_caches();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -156,6 +188,7 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state) const;
+	bool reset_instance(Node *p_root) const;
 
 	Array setup_resources_in_array(Array &array_to_scan, const SceneState::NodeData &n, HashMap<Ref<Resource>, Ref<Resource>> &resources_local_to_sub_scene, Node *node, const StringName sname, HashMap<Ref<Resource>, Ref<Resource>> &resources_local_to_scene, int i, Node **ret_nodes, SceneState::GenEditState p_edit_state) const;
 	Variant make_local_resource(Variant &value, const SceneState::NodeData &p_node_data, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_sub_scene, Node *p_node, const StringName p_sname, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_scene, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const;
@@ -233,6 +266,10 @@ class PackedScene : public Resource {
 
 	Ref<SceneState> state;
 
+	mutable Mutex pool_mutex;
+	LocalVector<ObjectID> instance_pool;
+	int max_pooled_instances = 64;
+
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
@@ -256,6 +293,13 @@ public:
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
 
+	Node *acquire_instance();
+	void release_instance(Node *p_node);
+	void clear_instance_pool();
+	int get_pooled_instance_count() const;
+	void set_max_pooled_instances(int p_max);
+	int get_max_pooled_instances() const;
+
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
 
@@ -274,6 +318,7 @@ public:
 	Ref<SceneState> get_state() const;
 
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
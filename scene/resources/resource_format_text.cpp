@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/missing_resource.h"
 #include "core/io/resource_format_binary.h"
 #include "core/object/script_language.h"
@@ -1998,14 +1999,29 @@ static String _resource_get_class(Ref<Resource> p_resource) {
 }
 
 Error ResourceFormatSaverTextInstance::save(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags) {
-	if (p_path.ends_with(".tscn")) {
-		packed_scene = p_resource;
-	}
-
 	Error err;
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
 	ERR_FAIL_COND_V_MSG(err, ERR_CANT_OPEN, "Cannot save file '" + p_path + "'.");
-	Ref<FileAccess> _fref(f);
+
+	return _save(f, p_path, p_resource, p_flags);
+}
+
+Error ResourceFormatSaverTextInstance::save_to_buffer(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags, Vector<uint8_t> &r_buffer) {
+	Ref<FileAccessMemory> f;
+	f.instantiate();
+	f->open_growable();
+
+	Error err = _save(f, p_path, p_resource, p_flags);
+	if (err == OK) {
+		r_buffer = f->get_data();
+	}
+	return err;
+}
+
+Error ResourceFormatSaverTextInstance::_save(Ref<FileAccess> f, const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags) {
+	if (p_path.ends_with(".tscn")) {
+		packed_scene = p_resource;
+	}
 
 	local_path = ProjectSettings::get_singleton()->localize_path(p_path);
 
@@ -2416,6 +2432,15 @@ Error ResourceFormatSaverText::save(const Ref<Resource> &p_resource, const Strin
 	return saver.save(p_path, p_resource, p_flags);
 }
 
+Error ResourceFormatSaverText::save_to_buffer(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags, Vector<uint8_t> &r_buffer, String &r_compression_magic) {
+	if (p_path.ends_with(".tscn") && !Ref<PackedScene>(p_resource).is_valid()) {
+		return ERR_FILE_UNRECOGNIZED;
+	}
+
+	ResourceFormatSaverTextInstance saver;
+	return saver.save_to_buffer(p_path, p_resource, p_flags, r_buffer);
+}
+
 Error ResourceFormatSaverText::set_uid(const String &p_path, ResourceUID::ID p_uid) {
 	String lc = p_path.to_lower();
 	if (!lc.ends_with(".tscn") && !lc.ends_with(".tres")) {
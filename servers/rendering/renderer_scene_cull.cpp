@@ -2762,9 +2762,33 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 	Transform3D inv_cam_transform = cull_data.cam_transform.inverse();
 	float z_near = cull_data.camera_matrix->get_z_near();
 
+	// The camera frustum test is done ahead of time for blocks of instances,
+	// so their bounds can be tested together.
+	static_assert(sizeof(InstanceBounds) == sizeof(real_t) * 6);
+	const uint64_t frustum_block_size = 64;
+	bool in_frustum_block[frustum_block_size];
+	uint64_t frustum_block_from = p_from;
+	uint64_t frustum_block_to = p_from;
+
 	for (uint64_t i = p_from; i < p_to; i++) {
 		bool mesh_visible = false;
 
+		if (i == frustum_block_to) {
+			frustum_block_from = i;
+			frustum_block_to = MIN((i & ~(frustum_block_size - 1)) + frustum_block_size, p_to);
+			uint32_t block_count = frustum_block_to - frustum_block_from;
+			const InstanceBounds *block_bounds = &cull_data.scenario->instance_aabbs[frustum_block_from];
+
+			if (&cull_data.scenario->instance_aabbs[frustum_block_to - 1] == block_bounds + block_count - 1) {
+				AABB::intersects_planes_batch(block_bounds->bounds, block_count, cull_data.cull->frustum.planes_ptr, cull_data.cull->frustum.plane_count, in_frustum_block);
+			} else {
+				// The block spans two pages.
+				for (uint32_t j = 0; j < block_count; j++) {
+					in_frustum_block[j] = cull_data.scenario->instance_aabbs[frustum_block_from + j].in_frustum(cull_data.cull->frustum);
+				}
+			}
+		}
+
 		InstanceData &idata = cull_data.scenario->instance_data[i];
 		uint32_t visibility_flags = idata.flags & (InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE | InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN | InstanceData::FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN);
 		int32_t visibility_check = -1;
@@ -2778,7 +2802,7 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 #define OCCLUSION_CULLED (cull_data.occlusion_buffer != nullptr && (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.occlusion_buffer->is_occluded(cull_data.scenario->instance_aabbs[i].bounds, cull_data.cam_transform.origin, inv_cam_transform, *cull_data.camera_matrix, z_near, cull_data.scenario->instance_data[i].occlusion_timeout))
 
 		if (!HIDDEN_BY_VISIBILITY_CHECKS) {
-			if ((LAYER_CHECK && IN_FRUSTUM(cull_data.cull->frustum) && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
+			if ((LAYER_CHECK && in_frustum_block[i - frustum_block_from] && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
 				uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 				if (base_type == RS::INSTANCE_LIGHT) {
 					cull_result.lights.push_back(idata.instance);
@@ -32,6 +32,8 @@
 #define TEST_FILE_ACCESS_H
 
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
+#include "core/os/os.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -107,6 +109,133 @@ TEST_CASE("[FileAccess] Get as UTF-8 String") {
 	CHECK(s_cr == "Hello darkness\rMy old friend\rI've come to talk\rWith you again\r");
 	CHECK(s_cr_nocr == "Hello darknessMy old friendI've come to talkWith you again");
 }
+
+TEST_CASE("[FileAccess] Buffer view") {
+	Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("line_endings_crlf.test.txt"), FileAccess::READ);
+	REQUIRE(!f.is_null());
+
+	f->seek(6);
+	const uint8_t *view = f->get_buffer_view(8);
+#ifdef UNIX_ENABLED
+	// Backed by mmap, so views must be available for regular files.
+	REQUIRE(view != nullptr);
+#endif
+	if (view) {
+		CHECK(memcmp(view, "darkness", 8) == 0);
+		CHECK(f->get_position() == 14);
+
+		// Consecutive views continue from the previous one.
+		const uint8_t *next_view = f->get_buffer_view(2);
+		REQUIRE(next_view != nullptr);
+		CHECK(memcmp(next_view, "\r\n", 2) == 0);
+		CHECK(f->get_position() == 16);
+
+		// Regular reads continue after the viewed range.
+		CHECK(f->get_8() == 'M');
+		CHECK(f->get_position() == 17);
+
+		// Earlier views stay valid after more reads.
+		CHECK(memcmp(view, "darkness", 8) == 0);
+	} else {
+		// Not supported by this backend, the position must not move.
+		CHECK(f->get_position() == 6);
+	}
+
+	// Ranges past the end of the file are never returned.
+	f->seek(f->get_length() - 2);
+	CHECK(f->get_buffer_view(4) == nullptr);
+	CHECK(f->get_position() == f->get_length() - 2);
+}
+
+TEST_CASE("[FileAccess] Compressed buffer round trip") {
+	Vector<uint8_t> data;
+	data.resize(10000); // Not a multiple of the block size, so the last block is partial.
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = (i / 7) % 256;
+	}
+
+	Vector<uint8_t> compressed = FileAccessCompressed::compress_buffer(data.ptr(), data.size(), "TEST", Compression::MODE_ZSTD, 4096);
+	REQUIRE(!compressed.is_empty());
+	CHECK(compressed.size() < data.size());
+
+	const String path = OS::get_singleton()->get_cache_path().path_join("compressed_buffer.bin");
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(compressed.ptr(), compressed.size());
+	}
+
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	char magic[5] = {};
+	f->get_buffer((uint8_t *)magic, 4);
+	CHECK(String(magic) == "TEST");
+
+	Ref<FileAccessCompressed> fac;
+	fac.instantiate();
+	REQUIRE(fac->open_after_magic(f) == OK);
+	CHECK(fac->get_length() == (uint64_t)data.size());
+
+	Vector<uint8_t> read;
+	read.resize(data.size());
+	CHECK(fac->get_buffer(read.ptrw(), read.size()) == (uint64_t)data.size());
+	CHECK(read == data);
+}
+
+TEST_CASE("[FileAccess] Compressed file with many blocks") {
+	Vector<uint8_t> data;
+	data.resize(4096 * 32); // An exact multiple of the block size, so the last block is empty.
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = (i * 31 + i / 1000) % 256;
+	}
+
+	const String path = OS::get_singleton()->get_cache_path().path_join("compressed_blocks.bin");
+	{
+		Ref<FileAccess> f = FileAccess::open_compressed(path, FileAccess::WRITE, FileAccess::COMPRESSION_ZSTD);
+		REQUIRE(f.is_valid());
+		f->store_buffer(data.ptr(), data.size());
+	}
+
+	Ref<FileAccess> f = FileAccess::open_compressed(path, FileAccess::READ, FileAccess::COMPRESSION_ZSTD);
+	REQUIRE(f.is_valid());
+	CHECK(f->get_length() == (uint64_t)data.size());
+
+	Vector<uint8_t> read;
+	read.resize(data.size());
+
+	SUBCASE("Whole file at once") {
+		CHECK(f->get_buffer(read.ptrw(), read.size()) == (uint64_t)data.size());
+		CHECK(read == data);
+		CHECK(f->get_position() == (uint64_t)data.size());
+		CHECK_FALSE(f->eof_reached());
+
+		f->get_8();
+		CHECK(f->eof_reached());
+	}
+
+	SUBCASE("Unaligned chunks") {
+		uint64_t ofs = 0;
+		while (ofs < (uint64_t)data.size()) {
+			ofs += f->get_buffer(read.ptrw() + ofs, MIN((uint64_t)10000, data.size() - ofs));
+		}
+		CHECK(read == data);
+	}
+
+	SUBCASE("Seeking between bulk reads") {
+		f->seek(5000);
+		CHECK(f->get_buffer(read.ptrw(), 20000) == 20000);
+		CHECK(memcmp(read.ptr(), data.ptr() + 5000, 20000) == 0);
+		CHECK(f->get_position() == 25000);
+
+		f->seek(24000);
+		CHECK(f->get_8() == data[24000]);
+
+		f->seek(data.size() - 100);
+		CHECK(f->get_buffer(read.ptrw(), 1000) == 100);
+		CHECK(memcmp(read.ptr(), data.ptr() + data.size() - 100, 100) == 0);
+		CHECK(f->eof_reached());
+	}
+}
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
@@ -117,6 +117,122 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Files with identical contents are stored once") {
+	const String base_dir = OS::get_singleton()->get_executable_path().get_base_dir();
+	const String icon_path = base_dir.path_join("../icon.png");
+	const uint64_t icon_size = FileAccess::get_file_as_bytes(icon_path).size();
+	REQUIRE(icon_size > 0);
+
+	PCKPacker single_packer;
+	const String single_pck_path = OS::get_singleton()->get_cache_path().path_join("output_single.pck");
+	REQUIRE(single_packer.pck_start(single_pck_path) == OK);
+	REQUIRE(single_packer.add_file("icon.png", icon_path) == OK);
+	REQUIRE(single_packer.flush() == OK);
+
+	PCKPacker duplicate_packer;
+	const String duplicate_pck_path = OS::get_singleton()->get_cache_path().path_join("output_duplicate.pck");
+	REQUIRE(duplicate_packer.pck_start(duplicate_pck_path) == OK);
+	REQUIRE(duplicate_packer.add_file("icon.png", icon_path) == OK);
+	REQUIRE(duplicate_packer.add_file("copies/icon.png", icon_path) == OK);
+	REQUIRE(duplicate_packer.flush() == OK);
+
+	Ref<FileAccess> single = FileAccess::open(single_pck_path, FileAccess::READ);
+	Ref<FileAccess> duplicate = FileAccess::open(duplicate_pck_path, FileAccess::READ);
+	REQUIRE(single.is_valid());
+	REQUIRE(duplicate.is_valid());
+	CHECK_MESSAGE(
+			duplicate->get_length() - single->get_length() < icon_size,
+			"The second copy should only add a directory entry, not its data.");
+}
+
+TEST_CASE("[PCKPacker] Files are found through the hashed index") {
+	const String base_dir = OS::get_singleton()->get_executable_path().get_base_dir();
+	const String icon_path = base_dir.path_join("../icon.png");
+	const String logo_path = base_dir.path_join("../logo.png");
+	const Vector<uint8_t> icon = FileAccess::get_file_as_bytes(icon_path);
+	const Vector<uint8_t> logo = FileAccess::get_file_as_bytes(logo_path);
+	REQUIRE(!icon.is_empty());
+	REQUIRE(!logo.is_empty());
+
+	PCKPacker first_packer;
+	const String first_pck_path = OS::get_singleton()->get_cache_path().path_join("output_index_first.pck");
+	REQUIRE(first_packer.pck_start(first_pck_path) == OK);
+	REQUIRE(first_packer.add_file("res://index_test/icon.png", icon_path) == OK);
+	REQUIRE(first_packer.add_file("res://index_test/shared.png", icon_path) == OK);
+	REQUIRE(first_packer.flush() == OK);
+
+	PCKPacker second_packer;
+	const String second_pck_path = OS::get_singleton()->get_cache_path().path_join("output_index_second.pck");
+	REQUIRE(second_packer.pck_start(second_pck_path) == OK);
+	REQUIRE(second_packer.add_file("res://index_test/shared.png", logo_path) == OK);
+	REQUIRE(second_packer.flush() == OK);
+
+	// Not the singleton, so the packs aren't mounted for other tests.
+	PackedData packed_data;
+	REQUIRE(packed_data.add_pack(first_pck_path, false, 0) == OK);
+	CHECK(packed_data.has_path("res://index_test/icon.png"));
+	CHECK_MESSAGE(packed_data.has_path("res://index_test//icon.png"), "Paths should be simplified before they are looked up.");
+	CHECK_FALSE(packed_data.has_path("res://index_test/missing.png"));
+
+	Ref<FileAccess> f = packed_data.try_open_path("res://index_test/icon.png");
+	REQUIRE(f.is_valid());
+	CHECK(f->get_length() == uint64_t(icon.size()));
+	CHECK(f->get_buffer(icon.size()) == icon);
+
+	SUBCASE("Packs mounted to replace files override earlier ones") {
+		REQUIRE(packed_data.add_pack(second_pck_path, true, 0) == OK);
+		f = packed_data.try_open_path("res://index_test/shared.png");
+		REQUIRE(f.is_valid());
+		CHECK(f->get_buffer(f->get_length()) == logo);
+	}
+
+	SUBCASE("Other packs only add files that are missing") {
+		REQUIRE(packed_data.add_pack(second_pck_path, false, 0) == OK);
+		f = packed_data.try_open_path("res://index_test/shared.png");
+		REQUIRE(f.is_valid());
+		CHECK(f->get_buffer(f->get_length()) == icon);
+	}
+}
+
+TEST_CASE("[PCKPacker] Compressed files are read back through the pack") {
+	const String source_path = OS::get_singleton()->get_cache_path().path_join("compressible.bin");
+	Vector<uint8_t> source;
+	source.resize(100000);
+	for (int i = 0; i < source.size(); i++) {
+		source.write[i] = (i / 7) % 256;
+	}
+	{
+		Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(source);
+	}
+
+	PCKPacker pck_packer;
+	const String output_pck_path = OS::get_singleton()->get_cache_path().path_join("output_compressed.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	pck_packer.set_compress_files(true);
+	REQUIRE(pck_packer.add_file("res://pck_packer_tests/compressed.bin", source_path) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	CHECK_MESSAGE(
+			FileAccess::get_file_as_bytes(output_pck_path).size() < source.size(),
+			"The compressible file should take less space in the PCK than on disk.");
+
+	// Not the singleton, so the pack isn't mounted for other tests.
+	PackedData packed_data;
+	REQUIRE(packed_data.add_pack(output_pck_path, true, 0) == OK);
+	Ref<FileAccess> f = packed_data.try_open_path("res://pck_packer_tests/compressed.bin");
+	REQUIRE(f.is_valid());
+	CHECK_MESSAGE(
+			f->get_length() == uint64_t(source.size()),
+			"The compressed file should report its original size.");
+
+	Vector<uint8_t> read;
+	read.resize(source.size());
+	CHECK(f->get_buffer(read.ptrw(), read.size()) == uint64_t(source.size()));
+	CHECK_MESSAGE(read == source, "The data read back should match the source file.");
+}
 } // namespace TestPCKPacker
 
 #endif // TEST_PCK_PACKER_H
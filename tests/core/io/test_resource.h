@@ -32,9 +32,11 @@
 #define TEST_RESOURCE_H
 
 #include "core/io/resource.h"
+#include "core/io/resource_format_binary.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/os/os.h"
+#include "core/os/semaphore.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -112,6 +114,231 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Threaded saving") {
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Hello world");
+	resource->set_meta("ExampleMetadata", Vector2i(40, 80));
+	PackedInt32Array data;
+	data.resize(64 * 1024);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = i % 97;
+	}
+	resource->set_meta("data", data);
+
+	const String save_path_binary = OS::get_singleton()->get_cache_path().path_join("resource_threaded.res");
+	const String save_path_text = OS::get_singleton()->get_cache_path().path_join("resource_threaded.tres");
+	CHECK(ResourceSaver::save_threaded(resource, save_path_binary, ResourceSaver::FLAG_COMPRESS) == OK);
+	CHECK(ResourceSaver::save_threaded(resource, save_path_text) == OK);
+
+	// The data is captured when the save starts, later changes must not leak into the files.
+	resource->set_name("Changed");
+
+	ResourceSaver::wait_for_threaded_saves();
+	CHECK_FALSE(ResourceSaver::is_threaded_save_pending(save_path_binary));
+	CHECK_FALSE(ResourceSaver::is_threaded_save_pending(save_path_text));
+	CHECK_FALSE(FileAccess::exists(save_path_binary + ".tmp"));
+	CHECK_FALSE(FileAccess::exists(save_path_text + ".tmp"));
+
+	const Ref<Resource> loaded_resource_binary = ResourceLoader::load(save_path_binary, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded_resource_binary.is_valid());
+	CHECK(loaded_resource_binary->get_name() == "Hello world");
+	CHECK(loaded_resource_binary->get_meta("ExampleMetadata") == Vector2i(40, 80));
+	CHECK(loaded_resource_binary->get_meta("data") == data);
+
+	const Ref<Resource> loaded_resource_text = ResourceLoader::load(save_path_text, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded_resource_text.is_valid());
+	CHECK(loaded_resource_text->get_name() == "Hello world");
+	CHECK(loaded_resource_text->get_meta("ExampleMetadata") == Vector2i(40, 80));
+	CHECK(loaded_resource_text->get_meta("data") == data);
+}
+
+TEST_CASE("[Resource] Saving over a pending threaded save") {
+	Ref<Resource> resource = memnew(Resource);
+	PackedInt32Array data;
+	data.resize(256 * 1024);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = i % 89;
+	}
+	resource->set_meta("data", data);
+
+	const String save_path = OS::get_singleton()->get_cache_path().path_join("resource_threaded_then_sync.res");
+
+	resource->set_name("Threaded");
+	CHECK(ResourceSaver::save_threaded(resource, save_path, ResourceSaver::FLAG_COMPRESS) == OK);
+	resource->set_name("Synchronous");
+	CHECK(ResourceSaver::save(resource, save_path) == OK);
+	CHECK_FALSE(ResourceSaver::is_threaded_save_pending(save_path));
+
+	// Nothing may be renamed over the synchronous save once it returned.
+	ResourceSaver::wait_for_threaded_saves();
+	const Ref<Resource> loaded_resource = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded_resource.is_valid());
+	CHECK(loaded_resource->get_name() == "Synchronous");
+
+	// Loading waits for a pending threaded save of the same file.
+	resource->set_name("Threaded again");
+	CHECK(ResourceSaver::save_threaded(resource, save_path, ResourceSaver::FLAG_COMPRESS) == OK);
+	const Ref<Resource> reloaded_resource = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(reloaded_resource.is_valid());
+	CHECK(reloaded_resource->get_name() == "Threaded again");
+	CHECK(reloaded_resource->get_meta("data") == data);
+}
+
+TEST_CASE("[Resource] Loading large binary files with sub-threads") {
+	// Big enough for the properties of sub-resources to be parsed in parallel.
+	const int child_count = 8;
+	const int data_size = 256 * 1024;
+
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Root");
+	Ref<Resource> previous;
+	for (int i = 0; i < child_count; i++) {
+		Ref<Resource> child = memnew(Resource);
+		child->set_name(vformat("Child %d", i));
+		PackedByteArray data;
+		data.resize(data_size);
+		data.fill(i);
+		child->set_meta("data", data);
+		child->set_meta("previous", previous);
+		previous = child;
+	}
+	resource->set_meta("last_child", previous);
+
+	const String save_path = OS::get_singleton()->get_cache_path().path_join("resource_large.res");
+	REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+
+	Ref<ResourceFormatLoaderBinary> loader;
+	loader.instantiate();
+	Error err = FAILED;
+	Ref<Resource> loaded = loader->load(save_path, "", &err, true, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(err == OK);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_name() == "Root");
+
+	Ref<Resource> child = loaded->get_meta("last_child");
+	for (int i = child_count - 1; i >= 0; i--) {
+		REQUIRE(child.is_valid());
+		CHECK(child->get_name() == vformat("Child %d", i));
+		PackedByteArray data = child->get_meta("data");
+		REQUIRE(data.size() == data_size);
+		CHECK(data[0] == i);
+		CHECK(data[data_size - 1] == i);
+		child = child->get_meta("previous", Ref<Resource>());
+	}
+	CHECK(child.is_null());
+}
+
+TEST_CASE("[Resource] Threaded loading with priorities and cancellation") {
+	const int previous_max_loads = ResourceLoader::get_max_concurrent_loads();
+	ResourceLoader::set_max_concurrent_loads(1);
+
+	Vector<String> paths;
+	for (int i = 0; i < 4; i++) {
+		Ref<Resource> resource = memnew(Resource);
+		resource->set_name(vformat("Chunk %d", i));
+		const String save_path = OS::get_singleton()->get_cache_path().path_join(vformat("resource_chunk_%d.res", i));
+		REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+		paths.push_back(save_path);
+	}
+
+	for (const String &path : paths) {
+		CHECK(ResourceLoader::load_threaded_request(path) == OK);
+	}
+	CHECK(ResourceLoader::load_threaded_set_priority(paths[3], 10) == OK);
+
+	CHECK(ResourceLoader::load_threaded_cancel(paths[1]) == OK);
+	CHECK(ResourceLoader::load_threaded_get_status(paths[1]) == ResourceLoader::THREAD_LOAD_INVALID_RESOURCE);
+	CHECK(ResourceLoader::load_threaded_cancel(paths[1]) == ERR_INVALID_PARAMETER);
+
+	for (int i : { 0, 2, 3 }) {
+		Ref<Resource> loaded = ResourceLoader::load_threaded_get(paths[i]);
+		REQUIRE(loaded.is_valid());
+		CHECK(loaded->get_name() == vformat("Chunk %d", i));
+	}
+
+	// A cancelled load can be requested again.
+	CHECK(ResourceLoader::load_threaded_request(paths[1]) == OK);
+	Ref<Resource> loaded = ResourceLoader::load_threaded_get(paths[1]);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_name() == "Chunk 1");
+
+	ResourceLoader::set_max_concurrent_loads(previous_max_loads);
+}
+
+// Records the order in which loads start, and holds back the first one until told to go on.
+class PriorityOrderLoader : public ResourceFormatLoader {
+public:
+	Mutex mutex;
+	Vector<String> started;
+	Semaphore blocker_started;
+	Semaphore blocker_release;
+
+	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override {
+		{
+			MutexLock lock(mutex);
+			started.push_back(p_path.get_file().get_basename());
+		}
+		if (p_path.get_file().begins_with("blocker")) {
+			blocker_started.post();
+			blocker_release.wait();
+		}
+		if (r_error) {
+			*r_error = OK;
+		}
+		return memnew(Resource);
+	}
+
+	virtual void get_recognized_extensions(List<String> *p_extensions) const override {
+		p_extensions->push_back("prioritytest");
+	}
+
+	virtual bool handles_type(const String &p_type) const override {
+		return p_type == "Resource";
+	}
+
+	virtual String get_resource_type(const String &p_path) const override {
+		return p_path.get_extension() == "prioritytest" ? "Resource" : "";
+	}
+};
+
+TEST_CASE("[Resource] Threaded loads with a higher priority start first") {
+	Ref<PriorityOrderLoader> loader = memnew(PriorityOrderLoader);
+	ResourceLoader::add_resource_format_loader(loader, true);
+	const int previous_max_loads = ResourceLoader::get_max_concurrent_loads();
+	ResourceLoader::set_max_concurrent_loads(1);
+
+	// Keep the only slot busy so the other requests have to wait in the queue.
+	const String blocker_path = "res://priority_test/blocker.prioritytest";
+	REQUIRE(ResourceLoader::load_threaded_request(blocker_path) == OK);
+	loader->blocker_started.wait();
+
+	const String low_path = "res://priority_test/low.prioritytest";
+	const String high_path = "res://priority_test/high.prioritytest";
+	const String middle_path = "res://priority_test/middle.prioritytest";
+	CHECK(ResourceLoader::load_threaded_request(low_path, "", false, ResourceFormatLoader::CACHE_MODE_REUSE, 0) == OK);
+	CHECK(ResourceLoader::load_threaded_request(high_path, "", false, ResourceFormatLoader::CACHE_MODE_REUSE, 10) == OK);
+	CHECK(ResourceLoader::load_threaded_request(middle_path, "", false, ResourceFormatLoader::CACHE_MODE_REUSE, 5) == OK);
+	CHECK(ResourceLoader::load_threaded_get_status(low_path) == ResourceLoader::THREAD_LOAD_IN_PROGRESS);
+
+	loader->blocker_release.post();
+	// Collected in the expected order, since collecting a queued load starts it right away.
+	for (const String &path : { blocker_path, high_path, middle_path, low_path }) {
+		CHECK(ResourceLoader::load_threaded_get(path).is_valid());
+	}
+
+	{
+		MutexLock lock(loader->mutex);
+		REQUIRE(loader->started.size() == 4);
+		CHECK(loader->started[0] == "blocker");
+		CHECK(loader->started[1] == "high");
+		CHECK(loader->started[2] == "middle");
+		CHECK(loader->started[3] == "low");
+	}
+
+	ResourceLoader::set_max_concurrent_loads(previous_max_loads);
+	ResourceLoader::remove_resource_format_loader(loader);
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
@@ -480,6 +480,41 @@ TEST_CASE("[AABB] Finite number checks") {
 			"AABB with two components infinite should not be finite.");
 }
 
+TEST_CASE("[AABB] Intersects planes batch") {
+	// Planes of the box from (-4, -4, -4) to (5, 5, 5), facing outwards.
+	Vector<Plane> planes;
+	for (int i = 0; i < 3; i++) {
+		Vector3 normal;
+		normal[i] = 1;
+		planes.push_back(Plane(normal, 5));
+		planes.push_back(Plane(-normal, 4));
+	}
+
+	const AABB aabbs[6] = {
+		AABB(Vector3(-1, -1, -1), Vector3(2, 2, 2)),
+		AABB(Vector3(6, 0, 0), Vector3(1, 1, 1)),
+		AABB(Vector3(4, 4, 4), Vector3(3, 3, 3)),
+		AABB(Vector3(0, -10, 0), Vector3(1, 5, 1)),
+		AABB(Vector3(-20, -20, -20), Vector3(40, 40, 40)),
+		AABB(Vector3(0, 0, 5), Vector3(1, 1, 1)),
+	};
+	const bool expected[6] = { true, false, true, false, true, false };
+
+	real_t bounds[6 * 6];
+	for (int i = 0; i < 6; i++) {
+		for (int j = 0; j < 3; j++) {
+			bounds[i * 6 + j] = aabbs[i].position[j];
+			bounds[i * 6 + 3 + j] = aabbs[i].position[j] + aabbs[i].size[j];
+		}
+	}
+
+	bool results[6];
+	AABB::intersects_planes_batch(bounds, 6, planes.ptr(), planes.size(), results);
+	for (int i = 0; i < 6; i++) {
+		CHECK_MESSAGE(results[i] == expected[i], "intersects_planes_batch() should return the expected result.");
+	}
+}
+
 } // namespace TestAABB
 
 #endif // TEST_AABB_H
@@ -136,6 +136,34 @@ TEST_CASE("[Transform3D] Rotate in-place (local rotation)") {
 	const Transform3D rotated_transform = Transform3D(transform.rotated_local(Vector3(0, 1, 0), Math_PI));
 	CHECK_MESSAGE(rotated_transform.is_equal_approx(expected), "The rotated transform should have a new orientation but still be based on the same origin.");
 }
+
+TEST_CASE("[Transform3D] Batch transforms") {
+	const Transform3D transform = Transform3D(Basis(Vector3(1, 2, 3).normalized(), 0.5).scaled(Vector3(2, 0.5, 1.5)), Vector3(-3, 1, 4));
+
+	Vector<Vector3> points;
+	for (int i = 0; i < 7; i++) {
+		points.push_back(Vector3(i * 0.5 - 1, 3 - i, i * i * 0.25));
+	}
+
+	Vector<Vector3> transformed = transform.xform(points);
+	Vector<Vector3> in_place = points;
+	transform.xform_batch(in_place.ptr(), in_place.ptrw(), in_place.size());
+	for (int i = 0; i < points.size(); i++) {
+		CHECK_MESSAGE(transformed[i].is_equal_approx(transform.xform(points[i])), "xform_batch() should give the same result as xform().");
+		CHECK_MESSAGE(in_place[i].is_equal_approx(transform.xform(points[i])), "xform_batch() should work in place.");
+	}
+
+	const Transform3D other = Transform3D(Basis(Vector3(0, 1, 0), 1.2), Vector3(5, -6, 7));
+	const Transform3D product = transform * other;
+	float rows[12];
+	transform.mult_store_3x4(other, rows);
+	const Transform3D stored = Transform3D(
+			rows[0], rows[1], rows[2],
+			rows[4], rows[5], rows[6],
+			rows[8], rows[9], rows[10],
+			rows[3], rows[7], rows[11]);
+	CHECK_MESSAGE(stored.is_equal_approx(product), "mult_store_3x4() should store the product of both transforms.");
+}
 } // namespace TestTransform3D
 
 #endif // TEST_TRANSFORM_3D_H
@@ -32,6 +32,7 @@
 #define TEST_METHOD_BIND_H
 
 #include "core/object/class_db.h"
+#include "core/object/ref_counted.h"
 
 #include "tests/test_macros.h"
 
@@ -108,6 +109,14 @@ public:
 		test_valid[TEST_METHOD_OBJECT_CAST] = p_object->value == 1;
 	}
 
+	int test_method_ref_arg(const Ref<RefCounted> &p_ref) {
+		return p_ref.is_valid() ? p_ref->get_reference_count() : -1;
+	}
+
+	String test_method_string_args(const String &p_string, int p_arg) {
+		return p_string + itos(p_arg);
+	}
+
 	static void _bind_methods() {
 		ClassDB::bind_method(D_METHOD("test_method"), &MethodBindTester::test_method);
 		ClassDB::bind_method(D_METHOD("test_method_args"), &MethodBindTester::test_method_args);
@@ -119,6 +128,8 @@ public:
 		ClassDB::bind_method(D_METHOD("test_methodrc_args"), &MethodBindTester::test_methodrc_args);
 		ClassDB::bind_method(D_METHOD("test_method_default_args"), &MethodBindTester::test_method_default_args, DEFVAL(9) /* wrong on purpose */, DEFVAL(4), DEFVAL(5));
 		ClassDB::bind_method(D_METHOD("test_method_object_cast", "object"), &MethodBindTester::test_method_object_cast);
+		ClassDB::bind_method(D_METHOD("test_method_ref_arg", "ref"), &MethodBindTester::test_method_ref_arg);
+		ClassDB::bind_method(D_METHOD("test_method_string_args", "string", "arg"), &MethodBindTester::test_method_string_args);
 	}
 
 	virtual void run_tests() {
@@ -170,6 +181,46 @@ TEST_CASE("[MethodBind] check all method binds") {
 
 	memdelete(mbt);
 }
+
+TEST_CASE("[MethodBind] Typed ptrcall") {
+	MethodBindTester *mbt = memnew(MethodBindTester);
+	for (int i = 0; i < MethodBindTester::TEST_MAX; i++) {
+		mbt->test_valid[i] = false;
+	}
+
+	MethodBind *method = ClassDB::get_method("MethodBindTester", "test_methodr_args");
+	REQUIRE(method);
+	CHECK(method->ptrcall_typed<int>(mbt, 1234) == 1234);
+	CHECK(mbt->test_valid[MethodBindTester::TEST_METHODR_ARGS]);
+
+	method = ClassDB::get_method("MethodBindTester", "test_method_args");
+	REQUIRE(method);
+	mbt->test_num = 42;
+	method->ptrcall_typed(mbt, 42);
+	CHECK(mbt->test_valid[MethodBindTester::TEST_METHOD_ARGS]);
+
+	method = ClassDB::get_method("MethodBindTester", "test_method_string_args");
+	REQUIRE(method);
+	CHECK(method->ptrcall_typed<String>(mbt, String("value_"), 7) == "value_7");
+
+	// Reference arguments are passed through without taking an extra reference.
+	method = ClassDB::get_method("MethodBindTester", "test_method_ref_arg");
+	REQUIRE(method);
+	Ref<RefCounted> ref;
+	ref.instantiate();
+	CHECK(method->ptrcall_typed<int>(mbt, ref) == 1);
+	CHECK(method->ptrcall_typed<int>(mbt, Ref<RefCounted>()) == -1);
+	CHECK(ref->get_reference_count() == 1);
+
+	// The generic ptrcall can't rely on the caller keeping the argument alive, so it still holds its own.
+	const void *args[1] = { &ref };
+	int64_t ret = 0;
+	method->ptrcall(mbt, args, &ret);
+	CHECK(ret == 2);
+	CHECK(ref->get_reference_count() == 1);
+
+	memdelete(mbt);
+}
 } // namespace TestMethodBind
 
 #endif // TEST_METHOD_BIND_H
@@ -0,0 +1,105 @@
+/**************************************************************************/
+/*  test_memory.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MEMORY_H
+#define TEST_MEMORY_H
+
+#include "core/os/memory.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMemory {
+
+TEST_CASE("[Memory] Tag scopes") {
+	CHECK(Memory::get_current_tag() == Memory::TAG_GENERAL);
+	{
+		MemoryTagScope memory_tag(Memory::TAG_PHYSICS);
+		CHECK(Memory::get_current_tag() == Memory::TAG_PHYSICS);
+		{
+			MemoryTagScope nested_memory_tag(Memory::TAG_SCRIPT);
+			CHECK(Memory::get_current_tag() == Memory::TAG_SCRIPT);
+		}
+		CHECK_MESSAGE(Memory::get_current_tag() == Memory::TAG_PHYSICS, "The previous tag should be restored when a scope ends.");
+	}
+	CHECK(Memory::get_current_tag() == Memory::TAG_GENERAL);
+}
+
+TEST_CASE("[Memory] Tagged allocations are accounted for") {
+	const uint64_t alloc_count = Memory::get_tag_alloc_count(Memory::TAG_RESOURCES);
+	const uint64_t mem_usage = Memory::get_tag_mem_usage(Memory::TAG_RESOURCES);
+
+	void *mem = nullptr;
+	{
+		MemoryTagScope memory_tag(Memory::TAG_RESOURCES);
+		mem = memalloc(1024);
+	}
+
+#ifdef DEBUG_ENABLED
+	CHECK(Memory::get_tag_alloc_count(Memory::TAG_RESOURCES) == alloc_count + 1);
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_RESOURCES) == mem_usage + 1024);
+
+	// Reallocations and frees are accounted to the tag the memory was allocated with.
+	mem = memrealloc(mem, 4096);
+	CHECK(Memory::get_tag_alloc_count(Memory::TAG_RESOURCES) == alloc_count + 1);
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_RESOURCES) == mem_usage + 4096);
+	CHECK(Memory::get_tag_mem_max_usage(Memory::TAG_RESOURCES) >= mem_usage + 4096);
+
+	memfree(mem);
+	CHECK_MESSAGE(Memory::get_tag_alloc_count(Memory::TAG_RESOURCES) == alloc_count, "Only live allocations should be counted.");
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_RESOURCES) == mem_usage);
+
+	Memory::reset_tag_stats(Memory::TAG_RESOURCES);
+	CHECK(Memory::get_tag_alloc_count(Memory::TAG_RESOURCES) == alloc_count);
+	CHECK(Memory::get_tag_mem_max_usage(Memory::TAG_RESOURCES) == mem_usage);
+#else
+	// Release builds only count the allocations made, and only when enabled.
+	memfree(mem);
+	CHECK(mem_usage == 0);
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_RESOURCES) == 0);
+	CHECK(Memory::get_tag_alloc_count(Memory::TAG_RESOURCES) == alloc_count);
+
+	const bool was_counting = Memory::is_tag_counting_enabled();
+	Memory::set_tag_counting_enabled(true);
+	Memory::reset_tag_stats(Memory::TAG_RESOURCES);
+	{
+		MemoryTagScope memory_tag(Memory::TAG_RESOURCES);
+		mem = memalloc(1024);
+	}
+	memfree(mem);
+	CHECK_MESSAGE(Memory::get_tag_alloc_count(Memory::TAG_RESOURCES) >= 1, "Frees can't be attributed to a tag in release builds.");
+
+	Memory::reset_tag_stats(Memory::TAG_RESOURCES);
+	Memory::set_tag_counting_enabled(was_counting);
+#endif
+}
+
+} // namespace TestMemory
+
+#endif // TEST_MEMORY_H
@@ -1626,6 +1626,42 @@ TEST_CASE("[String] hash") {
 	CHECK(a.hash64() != c.hash64());
 }
 
+TEST_CASE("[String] Cached hash is reset on modification") {
+	String a = "Test";
+	const uint32_t test_hash = a.hash();
+	CHECK(a.hash() == test_hash);
+	CHECK(a.hash() == String::hash(U"Test"));
+
+	// Copies share the buffer and its cached hash until one of them is modified.
+	String b = a;
+	CHECK(b.hash() == test_hash);
+	b[0] = 'W';
+	CHECK(b.hash() == String::hash(U"West"));
+	CHECK(a.hash() == test_hash);
+
+	a[0] = 'B';
+	CHECK(a.hash() == String::hash(U"Best"));
+	a += "s";
+	CHECK(a.hash() == String::hash(U"Bests"));
+	a.ptrw()[1] = 'a';
+	CHECK(a.hash() == String::hash(U"Basts"));
+	a.set(0, 'P');
+	CHECK(a.hash() == String::hash(U"Pasts"));
+	a.resize(4);
+	a.ptrw()[3] = 0;
+	CHECK(a.hash() == String::hash(U"Pas"));
+
+	// Equality must not be affected by hashes cached on either side.
+	String c = "Pas";
+	String d = "Pat";
+	c.hash();
+	d.hash();
+	CHECK(a == c);
+	CHECK(c != d);
+	d[2] = 's';
+	CHECK(c == d);
+}
+
 TEST_CASE("[String] uri_encode/unescape") {
 	String s = "Godot Engine:'docs'";
 	String t = "Godot%20Engine%3A%27docs%27";
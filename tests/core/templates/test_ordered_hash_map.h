@@ -0,0 +1,167 @@
+/**************************************************************************/
+/*  test_ordered_hash_map.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_ORDERED_HASH_MAP_H
+#define TEST_ORDERED_HASH_MAP_H
+
+#include "core/templates/ordered_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestOrderedHashMap {
+
+TEST_CASE("[OrderedHashMap] Insert element") {
+	OrderedHashMap<int, int> map;
+	OrderedHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+}
+
+TEST_CASE("[OrderedHashMap] Overwrite element") {
+	OrderedHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map[42] == 1234);
+	CHECK(map.size() == 1);
+}
+
+TEST_CASE("[OrderedHashMap] Erase via element") {
+	OrderedHashMap<int, int> map;
+	OrderedHashMap<int, int>::Iterator e = map.insert(42, 84);
+	map.remove(e);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[OrderedHashMap] Erase via key") {
+	OrderedHashMap<int, int> map;
+	map.insert(42, 84);
+	CHECK(map.erase(42));
+	CHECK_FALSE(map.erase(42));
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+}
+
+TEST_CASE("[OrderedHashMap] Iteration keeps insertion order") {
+	OrderedHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	map.insert(0, 12934);
+	map.insert(123485, 1238888);
+	map.insert(123, 111111);
+	map.insert(7, 7);
+	map.erase(0);
+	map.insert(0, 1);
+
+	Vector<Pair<int, int>> expected;
+	expected.push_back(Pair<int, int>(42, 84));
+	expected.push_back(Pair<int, int>(123, 111111));
+	expected.push_back(Pair<int, int>(123485, 1238888));
+	expected.push_back(Pair<int, int>(7, 7));
+	expected.push_back(Pair<int, int>(0, 1));
+
+	int idx = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(expected[idx] == Pair<int, int>(E.key, E.value));
+		++idx;
+	}
+	CHECK(idx == expected.size());
+
+	const OrderedHashMap<int, int> const_map = map;
+	idx = 0;
+	for (const KeyValue<int, int> &E : const_map) {
+		CHECK(expected[idx] == Pair<int, int>(E.key, E.value));
+		++idx;
+	}
+	CHECK(idx == expected.size());
+
+	OrderedHashMap<int, int>::Iterator last = map.last();
+	CHECK(last->key == 0);
+	--last;
+	CHECK(last->key == 7);
+}
+
+TEST_CASE("[OrderedHashMap] Many elements") {
+	OrderedHashMap<int, int> map;
+	const int count = 10000;
+	for (int i = 0; i < count; i++) {
+		map.insert(i * 3, i);
+	}
+	CHECK(map.size() == count);
+
+	// Erasing most of the elements compacts the entries, the rest must keep their order.
+	for (int i = 0; i < count; i++) {
+		if (i % 10 != 0) {
+			CHECK(map.erase(i * 3));
+		}
+	}
+	CHECK(map.size() == count / 10);
+
+	int expected = 0;
+	bool in_order = true;
+	for (const KeyValue<int, int> &E : map) {
+		in_order = in_order && E.key == expected * 3 && E.value == expected;
+		expected += 10;
+	}
+	CHECK(in_order);
+	CHECK(expected == count);
+
+	bool found_all = true;
+	for (int i = 0; i < count; i++) {
+		found_all = found_all && map.has(i * 3) == (i % 10 == 0) && !map.has(i * 3 + 1);
+	}
+	CHECK(found_all);
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(map.begin() == map.end());
+}
+
+TEST_CASE("[OrderedHashMap] Values don't move when inserting") {
+	OrderedHashMap<int, int> map;
+	map[0] = 42;
+	int *value = &map[0];
+	for (int i = 1; i < 1000; i++) {
+		map[i] = i;
+	}
+	CHECK(map.getptr(0) == value);
+	CHECK(*value == 42);
+}
+
+} // namespace TestOrderedHashMap
+
+#endif // TEST_ORDERED_HASH_MAP_H
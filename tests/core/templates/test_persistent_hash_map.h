@@ -0,0 +1,117 @@
+/**************************************************************************/
+/*  test_persistent_hash_map.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_PERSISTENT_HASH_MAP_H
+#define TEST_PERSISTENT_HASH_MAP_H
+
+#include "core/templates/persistent_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPersistentHashMap {
+
+TEST_CASE("[PersistentHashMap] Insert, overwrite and erase") {
+	PersistentHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	CHECK(map.size() == 2);
+	CHECK(map.get(42) == 84);
+
+	map.insert(42, 1234);
+	CHECK(map.size() == 2);
+	CHECK(map.get(42) == 1234);
+
+	CHECK(map.erase(42));
+	CHECK_FALSE(map.erase(42));
+	CHECK(!map.has(42));
+	CHECK(map.getptr(42) == nullptr);
+	CHECK(map.has(123));
+	CHECK(map.size() == 1);
+}
+
+struct CollidingHasher {
+	static uint32_t hash(int p_key) { return p_key & 3; }
+};
+
+TEST_CASE("[PersistentHashMap] Colliding hashes") {
+	PersistentHashMap<int, int, CollidingHasher> map;
+	for (int i = 0; i < 100; i++) {
+		map.insert(i, i * 2);
+	}
+	for (int i = 0; i < 100; i += 2) {
+		map.erase(i);
+	}
+	CHECK(map.size() == 50);
+
+	bool all_valid = true;
+	for (int i = 0; i < 100; i++) {
+		const int *value = map.getptr(i);
+		all_valid = all_valid && (i % 2 == 0 ? value == nullptr : (value && *value == i * 2));
+	}
+	CHECK(all_valid);
+}
+
+TEST_CASE("[PersistentHashMap] Copies are independent and keep insertion order") {
+	PersistentHashMap<int, int> map;
+	const int count = 2000;
+	for (int i = 0; i < count; i++) {
+		map.insert(count - i, i);
+	}
+
+	PersistentHashMap<int, int> snapshot = map;
+	for (int i = 1; i <= count; i += 2) {
+		map.erase(i);
+	}
+	map.insert(count, -1);
+	map.insert(-5, -5);
+
+	CHECK(snapshot.size() == count);
+	CHECK(snapshot.get(count) == 0);
+	CHECK(snapshot.has(1));
+	CHECK(!snapshot.has(-5));
+
+	LocalVector<const PersistentHashMap<int, int>::Entry *> entries;
+	snapshot.get_entries(entries);
+	bool in_order = entries.size() == count;
+	for (uint32_t i = 0; in_order && i < entries.size(); i++) {
+		in_order = entries[i]->key == int(count - i) && entries[i]->value == int(i);
+	}
+	CHECK(in_order);
+
+	map.get_entries(entries);
+	REQUIRE(entries.size() == count / 2 + 1);
+	CHECK(entries[0]->key == count);
+	CHECK(entries[0]->value == -1);
+	CHECK(entries[entries.size() - 1]->key == -5);
+}
+
+} // namespace TestPersistentHashMap
+
+#endif // TEST_PERSISTENT_HASH_MAP_H
@@ -0,0 +1,98 @@
+/**************************************************************************/
+/*  test_persistent_vector.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_PERSISTENT_VECTOR_H
+#define TEST_PERSISTENT_VECTOR_H
+
+#include "core/templates/persistent_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPersistentVector {
+
+TEST_CASE("[PersistentVector] Push back, set and pop back") {
+	PersistentVector<int> vector;
+	CHECK(vector.is_empty());
+
+	const int count = 5000;
+	for (int i = 0; i < count; i++) {
+		vector.push_back(i);
+	}
+	CHECK(vector.size() == count);
+	vector.set(1234, -1);
+
+	bool all_valid = true;
+	for (int i = 0; i < count; i++) {
+		all_valid = all_valid && vector[i] == (i == 1234 ? -1 : i);
+	}
+	CHECK(all_valid);
+
+	for (int i = 0; i < count - 10; i++) {
+		vector.pop_back();
+	}
+	CHECK(vector.size() == 10);
+	CHECK(vector[9] == 9);
+
+	vector.clear();
+	CHECK(vector.is_empty());
+}
+
+TEST_CASE("[PersistentVector] Copies are independent") {
+	PersistentVector<int> vector;
+	for (int i = 0; i < 1000; i++) {
+		vector.push_back(i);
+	}
+
+	PersistentVector<int> snapshot = vector;
+	vector.set(0, -1);
+	vector.set(999, -1);
+	vector.push_back(1000);
+	for (int i = 0; i < 500; i++) {
+		vector.pop_back();
+	}
+	vector.set(100, -1);
+
+	CHECK(snapshot.size() == 1000);
+	bool snapshot_valid = true;
+	for (int i = 0; i < 1000; i++) {
+		snapshot_valid = snapshot_valid && snapshot[i] == i;
+	}
+	CHECK(snapshot_valid);
+
+	CHECK(vector.size() == 501);
+	CHECK(vector[0] == -1);
+	CHECK(vector[1] == 1);
+	CHECK(vector[100] == -1);
+	CHECK(vector[500] == 500);
+}
+
+} // namespace TestPersistentVector
+
+#endif // TEST_PERSISTENT_VECTOR_H
@@ -32,6 +32,7 @@
 #define TEST_ARRAY_H
 
 #include "core/variant/array.h"
+#include "core/variant/persistent_array.h"
 #include "tests/test_macros.h"
 #include "tests/test_tools.h"
 
@@ -597,6 +598,37 @@ TEST_CASE("[Array] Iteration and modification") {
 	a4.clear();
 }
 
+TEST_CASE("[Array] PersistentArray snapshots") {
+	Array array;
+	array.set_typed(Variant::INT, StringName(), Variant());
+	for (int i = 0; i < 100; i++) {
+		array.push_back(i);
+	}
+
+	PersistentArray state(array);
+	PersistentArray snapshot = state;
+	state.set(0, -1);
+	state.push_back(100);
+
+	CHECK(snapshot.size() == 100);
+	CHECK(snapshot[0] == Variant(0));
+	CHECK(state.size() == 101);
+	CHECK(state[0] == Variant(-1));
+
+	ERR_PRINT_OFF;
+	state.set(1, "1");
+	state.push_back(Vector2());
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(state[1] == Variant(1), "Values that don't match the array type should be rejected.");
+	CHECK(state.size() == 101);
+	CHECK(state.to_array().size() == 101);
+
+	Array restored = snapshot.to_array();
+	CHECK(restored.is_typed());
+	CHECK(restored.get_typed_builtin() == Variant::INT);
+	CHECK(restored == array);
+}
+
 } // namespace TestArray
 
 #endif // TEST_ARRAY_H
@@ -32,6 +32,7 @@
 #define TEST_DICTIONARY_H
 
 #include "core/variant/dictionary.h"
+#include "core/variant/persistent_dictionary.h"
 #include "tests/test_macros.h"
 
 namespace TestDictionary {
@@ -537,6 +538,35 @@ TEST_CASE("[Dictionary] Order and find") {
 	CHECK_EQ(d.find_key("does not exist"), Variant());
 }
 
+TEST_CASE("[Dictionary] PersistentDictionary snapshots") {
+	Dictionary dictionary;
+	dictionary["b"] = 1;
+	dictionary[StringName("a")] = 2;
+	dictionary[3] = "three";
+
+	PersistentDictionary state(dictionary);
+	PersistentDictionary snapshot = state;
+	state.set("a", 20);
+	state.erase(3);
+	state.set(4, "four");
+
+	// String and StringName keys are interchangeable, like in Dictionary.
+	CHECK(snapshot.get("a", Variant()) == Variant(2));
+	CHECK(snapshot.has(3));
+	CHECK(!snapshot.has(4));
+	CHECK(state.get(StringName("a"), Variant()) == Variant(20));
+	CHECK(!state.has(3));
+
+	Dictionary restored = snapshot.to_dictionary();
+	CHECK(restored == dictionary);
+	CHECK(restored.keys() == dictionary.keys());
+
+	Array keys = state.to_dictionary().keys();
+	REQUIRE(keys.size() == 3);
+	CHECK(keys[0] == Variant("b"));
+	CHECK(keys[2] == Variant(4));
+}
+
 } // namespace TestDictionary
 
 #endif // TEST_DICTIONARY_H
@@ -31,6 +31,10 @@
 #ifndef TEST_VARIANT_H
 #define TEST_VARIANT_H
 
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "core/variant/variant.h"
 #include "core/variant/variant_parser.h"
 
@@ -1755,6 +1759,66 @@ TEST_CASE("[Variant] Writer and parser array") {
 	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back.");
 }
 
+TEST_CASE("[Variant] Writer and parser packed arrays") {
+	PackedInt32Array int32_array;
+	PackedInt64Array int64_array;
+	PackedFloat32Array float32_array;
+	PackedFloat64Array float64_array;
+	PackedVector2Array vector2_array;
+	for (int i = 0; i < 1000; i++) {
+		int32_array.push_back(i * 7 - 3000);
+		int64_array.push_back(int64_t(i) * 10000000000);
+		float32_array.push_back(i * 0.25f);
+		float64_array.push_back(i * -0.125);
+		vector2_array.push_back(Vector2(i, -i * 0.5));
+	}
+	float64_array.push_back(INFINITY);
+
+	Array a = build_array(int32_array, int64_array, float32_array, float64_array, vector2_array, PackedInt32Array());
+	String a_str;
+	VariantWriter::write_to_string(a, a_str);
+
+	VariantParser::StreamString ss;
+	String errs;
+	int line = 1;
+	Variant a_parsed;
+
+	ss.s = a_str;
+	CHECK(VariantParser::parse(&ss, a_parsed, errs, line) == OK);
+	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back.");
+
+	// Whitespace, line breaks and comments are allowed between elements.
+	VariantParser::StreamString css;
+	css.s = "PackedInt32Array(1,\n2 ; comment\n , -3\n)";
+	line = 1;
+	CHECK(VariantParser::parse(&css, a_parsed, errs, line) == OK);
+	PackedInt32Array expected;
+	expected.push_back(1);
+	expected.push_back(2);
+	expected.push_back(-3);
+	CHECK(a_parsed == Variant(expected));
+	CHECK(line == 4);
+
+	VariantParser::StreamString ess;
+	ess.s = "PackedFloat32Array(1, \"2\")";
+	CHECK(VariantParser::parse(&ess, a_parsed, errs, line) == ERR_PARSE_ERROR);
+	CHECK(errs == "Expected float in constructor");
+
+	// Files are read through their own stream.
+	const String path = OS::get_singleton()->get_cache_path().path_join("parser_packed_arrays.txt");
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string(a_str);
+	}
+	VariantParser::StreamFile fs;
+	fs.f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(fs.f.is_valid());
+	line = 1;
+	CHECK(VariantParser::parse(&fs, a_parsed, errs, line) == OK);
+	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back from a file.");
+}
+
 TEST_CASE("[Variant] Writer recursive array") {
 	// There is no way to accurately represent a recursive array,
 	// the only thing we can do is make sure the writer doesn't blow up
@@ -2208,6 +2272,117 @@ TEST_CASE("[Variant] Operator NOT") {
 	}
 }
 
+struct PooledVariantsData {
+	LocalVector<Variant> variants;
+	SafeNumeric<uint32_t> mismatches;
+};
+
+static Variant make_pooled_variant(uint32_t p_index) {
+	real_t value = p_index;
+	switch (p_index % 5) {
+		case 0:
+			return Transform2D(value, Vector2(value, -value));
+		case 1:
+			return AABB(Vector3(value, 0, 0), Vector3(1, 2, 3));
+		case 2:
+			return Basis(Vector3(value, 0, 0), Vector3(0, value, 0), Vector3(0, 0, value));
+		case 3:
+			return Transform3D(Basis(), Vector3(value, value, value));
+		default: {
+			Projection projection;
+			projection.columns[3][0] = value;
+			return projection;
+		}
+	}
+}
+
+static void pooled_variant_construct_task(void *p_userdata, uint32_t p_index) {
+	PooledVariantsData *data = (PooledVariantsData *)p_userdata;
+	data->variants[p_index] = make_pooled_variant(p_index);
+}
+
+static void pooled_variant_release_task(void *p_userdata, uint32_t p_index) {
+	PooledVariantsData *data = (PooledVariantsData *)p_userdata;
+	// Elements are released in reverse order, so most of them are freed by a different thread than the one which allocated them.
+	uint32_t index = data->variants.size() - 1 - p_index;
+	if (data->variants[index] != make_pooled_variant(index)) {
+		data->mismatches.increment();
+	}
+	data->variants[index] = Variant();
+}
+
+TEST_CASE("[Variant] Pooled types constructed and freed across threads") {
+	const uint32_t count = 64 * 1024;
+	PooledVariantsData data;
+	data.variants.resize(count);
+
+	for (int pass = 0; pass < 4; pass++) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&pooled_variant_construct_task, &data, count, -1, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+		group = WorkerThreadPool::get_singleton()->add_native_group_task(&pooled_variant_release_task, &data, count, -1, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+		CHECK_MESSAGE(data.mismatches.get() == 0, "Variants should hold the values they were constructed with.");
+		for (uint32_t i = 0; i < count; i++) {
+			if (data.variants[i].get_type() != Variant::NIL) {
+				FAIL("All variants should have been released.");
+				break;
+			}
+		}
+	}
+}
+
+TEST_CASE("[Variant] Packed array bulk math") {
+	PackedFloat32Array floats;
+	floats.push_back(1.0);
+	floats.push_back(-2.0);
+	floats.push_back(3.0);
+	PackedFloat32Array other;
+	other.push_back(4.0);
+	other.push_back(5.0);
+	other.push_back(6.0);
+
+	Variant v = floats;
+	v.call("multiply_add_scalar", 2.0, 1.0);
+	CHECK(PackedFloat32Array(v) == Vector<float>({ 3.0, -3.0, 7.0 }));
+	v.call("add_array", other);
+	CHECK(PackedFloat32Array(v) == Vector<float>({ 7.0, 2.0, 13.0 }));
+	v.call("clamp", 0.0, 10.0);
+	CHECK(PackedFloat32Array(v) == Vector<float>({ 7.0, 2.0, 10.0 }));
+	v.call("lerp", other, 0.5);
+	CHECK(PackedFloat32Array(v) == Vector<float>({ 5.5, 3.5, 8.0 }));
+	CHECK(double(v.call("sum")) == doctest::Approx(17.0));
+	CHECK(double(v.call("dot", other)) == doctest::Approx(22.0 + 17.5 + 48.0));
+	CHECK(double(v.call("min")) == doctest::Approx(3.5));
+	CHECK(double(v.call("max")) == doctest::Approx(8.0));
+
+	PackedVector3Array vectors;
+	vectors.push_back(Vector3(1, 2, 3));
+	vectors.push_back(Vector3(-1, 0, 1));
+	v = vectors;
+	v.call("transform", Transform3D(Basis(), Vector3(1, 1, 1)));
+	v.call("multiply_scalar", 2.0);
+	CHECK(PackedVector3Array(v) == Vector<Vector3>({ Vector3(4, 6, 8), Vector3(0, 2, 4) }));
+	CHECK(Vector3(v.call("sum")) == Vector3(4, 8, 12));
+
+	// Large enough to be split across threads.
+	PackedFloat64Array doubles;
+	doubles.resize(1 << 20);
+	for (int i = 0; i < doubles.size(); i++) {
+		doubles.set(i, i);
+	}
+	v = doubles;
+	v.call("add_scalar", 1.0);
+	doubles = v;
+	bool all_valid = true;
+	for (int i = 0; i < doubles.size(); i++) {
+		all_valid = all_valid && doubles[i] == i + 1.0;
+	}
+	CHECK(all_valid);
+	CHECK(double(v.call("max")) == doctest::Approx(double(1 << 20)));
+}
+
 } // namespace TestVariant
 
 #endif // TEST_VARIANT_H
@@ -31,6 +31,8 @@
 #ifndef TEST_PACKED_SCENE_H
 #define TEST_PACKED_SCENE_H
 
+#include "scene/2d/node_2d.h"
+#include "scene/gui/control.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
@@ -150,6 +152,124 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Packed Scene Repeatedly With Properties") {
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+
+	Node2D *sprite = memnew(Node2D);
+	sprite->set_name("Node2D");
+	sprite->set_position(Vector2(12, 34));
+	sprite->set_rotation(0.5);
+	scene->add_child(sprite);
+	sprite->set_owner(scene);
+
+	// Offsets are indexed properties, set through a shared setter.
+	Control *control = memnew(Control);
+	control->set_name("Control");
+	control->set_offset(SIDE_LEFT, 5);
+	control->set_offset(SIDE_BOTTOM, 7);
+	scene->add_child(control);
+	control->set_owner(scene);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+
+	// Property setters are resolved on the first instantiation and reused afterwards.
+	for (int i = 0; i < 100; i++) {
+		Node *instance = packed_scene->instantiate();
+		REQUIRE(instance != nullptr);
+		REQUIRE(instance->get_child_count() == 2);
+
+		Node2D *node_2d = Object::cast_to<Node2D>(instance->get_child(0));
+		REQUIRE(node_2d != nullptr);
+		CHECK(node_2d->get_position() == Vector2(12, 34));
+		CHECK(node_2d->get_rotation() == doctest::Approx(0.5));
+
+		Control *instance_control = Object::cast_to<Control>(instance->get_child(1));
+		REQUIRE(instance_control != nullptr);
+		CHECK(instance_control->get_offset(SIDE_LEFT) == doctest::Approx(5));
+		CHECK(instance_control->get_offset(SIDE_BOTTOM) == doctest::Approx(7));
+		CHECK(instance_control->get_offset(SIDE_TOP) == doctest::Approx(0));
+
+		memdelete(instance);
+	}
+
+	// Changing the state must not reuse setters resolved for the previous contents.
+	Node *other = memnew(Node2D);
+	other->set_name("Other");
+	Object::cast_to<Node2D>(other)->set_position(Vector2(1, 2));
+	packed_scene->pack(other);
+	memdelete(other);
+
+	Node *instance = packed_scene->instantiate();
+	REQUIRE(Object::cast_to<Node2D>(instance) != nullptr);
+	CHECK(Object::cast_to<Node2D>(instance)->get_position() == Vector2(1, 2));
+	memdelete(instance);
+}
+
+TEST_CASE("[PackedScene] Reuse Released Instances") {
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_position(Vector2(3, 4));
+	child->add_to_group("stored_group", true);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+
+	Node2D *instance = Object::cast_to<Node2D>(packed_scene->acquire_instance());
+	REQUIRE(instance != nullptr);
+	CHECK(packed_scene->get_pooled_instance_count() == 0);
+
+	// Change stored and non-stored properties, as a game would while the instance is in use.
+	instance->set_name("Renamed");
+	instance->set_rotation(1.0);
+	Node2D *instance_child = Object::cast_to<Node2D>(instance->get_node(NodePath("Child")));
+	REQUIRE(instance_child != nullptr);
+	instance_child->set_position(Vector2(9, 9));
+	instance_child->add_to_group("runtime_group");
+
+	packed_scene->release_instance(instance);
+	CHECK(packed_scene->get_pooled_instance_count() == 1);
+
+	Node2D *reused = Object::cast_to<Node2D>(packed_scene->acquire_instance());
+	CHECK(reused == instance);
+	CHECK(packed_scene->get_pooled_instance_count() == 0);
+	CHECK(reused->get_name() == "TestScene");
+	CHECK(reused->get_rotation() == doctest::Approx(0.0));
+	CHECK(instance_child->get_position() == Vector2(3, 4));
+	CHECK(instance_child->is_in_group("stored_group"));
+	CHECK_FALSE(instance_child->is_in_group("runtime_group"));
+
+	SUBCASE("Instances with a different structure are not reused") {
+		Node *extra = memnew(Node);
+		reused->add_child(extra);
+		packed_scene->release_instance(reused);
+		CHECK(packed_scene->get_pooled_instance_count() == 0);
+	}
+
+	SUBCASE("Instances are not kept above the limit") {
+		packed_scene->set_max_pooled_instances(0);
+		packed_scene->release_instance(reused);
+		CHECK(packed_scene->get_pooled_instance_count() == 0);
+	}
+
+	SUBCASE("Pooled instances are freed with the pool") {
+		packed_scene->release_instance(reused);
+		CHECK(packed_scene->get_pooled_instance_count() == 1);
+		packed_scene->clear_instance_pool();
+		CHECK(packed_scene->get_pooled_instance_count() == 0);
+	}
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);